@@ -32,7 +32,8 @@ sli::pool::pool()
     capacity(0),
     chunks(0), 
     head(0),
-    initialized_(false)
+    initialized_(false),
+    lock_(0)
 {}
 
 sli::pool::pool(const sli::pool &p)
@@ -45,7 +46,8 @@ sli::pool::pool(const sli::pool &p)
     capacity(0),
     chunks(0), 
     head(0),
-    initialized_(false)
+    initialized_(false),
+    lock_(0)
 {}
 
 
@@ -59,7 +61,8 @@ sli::pool::pool(size_t n, size_t initial, size_t growth)
     capacity(0),
     chunks(0), 
     head(0),
-    initialized_(true)
+    initialized_(true),
+    lock_(0)
 {}
 
 void sli::pool::init(size_t n, size_t initial, size_t growth)
@@ -25,6 +25,7 @@
 #include <cassert>
 #include <cstdlib>
 #include <string>
+#include "config.h"
 
 namespace sli {
 
@@ -90,6 +91,7 @@ namespace sli {
     link  *head;           //!< head of free list
 
     bool  initialized_;    //!< True if the pool is initialized.
+    int   lock_;           //!< Spin lock for atomic reference counting.
 
     void grow(size_t);     //!< make pool larger by n elements
     void grow();           //!< make pool larger
@@ -133,9 +135,15 @@ namespace sli {
     inline size_t get_total() const;
   };
 
+  // With atomic reference counting, Datums may be created and destroyed
+  // in parallel regions, so the free list must be protected as well.
   inline
   void * pool::alloc(void)
   {
+#ifdef SLI_ATOMIC_REFCOUNT
+    while(__sync_lock_test_and_set(&lock_, 1))
+      ;
+#endif
 
     if(head==0)
     {
@@ -147,6 +155,10 @@ namespace sli {
 
     head = head->next;
     ++instantiations;
+
+#ifdef SLI_ATOMIC_REFCOUNT
+    __sync_lock_release(&lock_);
+#endif
     
     return p;
   }
@@ -155,9 +167,16 @@ namespace sli {
   void pool::free(void *elp)
   {
     link *p= static_cast<link *>(elp);
+#ifdef SLI_ATOMIC_REFCOUNT
+    while(__sync_lock_test_and_set(&lock_, 1))
+      ;
+#endif
     p->next= head;
     head = p;
     --instantiations;
+#ifdef SLI_ATOMIC_REFCOUNT
+    __sync_lock_release(&lock_);
+#endif
   }
 
   inline
@@ -29,6 +29,7 @@
 
 #include <cassert>
 #include <cstddef>
+#include "config.h"
 
 /**
 \class lockPTR
@@ -124,18 +125,29 @@ class lockPTR
     
     void addReference(void)
     {
+#ifdef SLI_ATOMIC_REFCOUNT
+      __sync_fetch_and_add(&number_of_references, 1);
+#else
       ++number_of_references;
+#endif
     }
 
     void removeReference(void)
     {
 //      assert(number_of_references > 0);
       
+#ifdef SLI_ATOMIC_REFCOUNT
+      if(__sync_sub_and_fetch(&number_of_references, 1) == 0)
+      {
+	delete this;
+      }
+#else
       --number_of_references;
       if(number_of_references == 0)
       {
 	delete this;
       }
+#endif
     }
 
     size_t references(void) const
@@ -344,6 +356,15 @@ class lockPTR
     {
       return (obj==NULL)? 0: obj->references();
     }
+
+  /**
+   * Size of the reference counting object which each lockPTR
+   * allocates in addition to the object it points to.
+   */
+  static size_t counter_size(void)
+    {
+      return sizeof(PointerObject);
+    }
 };
 
 #ifndef LOCK_PTR_NDEBUG
@@ -26,7 +26,7 @@
 #include <limits>
 #include <cmath>
 
-#if HAVE_EXPM1
+#if HAVE_EXPM1 || HAVE_LOG1P
 #  include <math.h>
 #endif
 
@@ -69,6 +69,25 @@ namespace numerics {
 #endif
   }
 
+/** Supply log1p() function independent of system.
+ *  @note Implemented inline for efficiency.
+ */
+  inline
+  double log1p(double x)
+  {
+#if HAVE_LOG1P
+    return ::log1p(x);  // use library implementation if available
+#else
+    // log(1+x) with the rounding error of 1+x compensated, see
+    // Goldberg, ACM Computing Surveys 23:5-48 (1991), Theorem 4
+    const double u = 1.0 + x;
+    if ( u == 1.0 )
+      return x;
+    else
+      return std::log(u) * x / (u - 1.0);
+#endif
+  }
+
 }
 
 
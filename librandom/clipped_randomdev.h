@@ -100,6 +100,9 @@ Author: Hans Ekkehard Plesser
     double operator()(void);
     double operator()(RngPtr) const;  // threaded
 
+    //! fill by calls to operator(), BaseRDV::fill() does not clip
+    void fill(RngPtr r, double* v, size_t n) const { RandomDev::fill(r, v, n); }
+
     //! set distribution parameters from SLI dict
     void set_status(const DictionaryDatum&);
 
@@ -209,6 +212,12 @@ Author: Hans Ekkehard Plesser
     double operator()(void);
     double operator()(RngPtr) const;  // threaded
 
+    //! fill by calls to operator(), BaseRDV::fill() does not clip
+    void fill(RngPtr r, double* v, size_t n) const { RandomDev::fill(r, v, n); }
+
+    //! fill by calls to ldev(), BaseRDV::fill() does not clip
+    void fill(RngPtr r, long* v, size_t n) const { RandomDev::fill(r, v, n); }
+
     long ldev(void);
     long ldev(RngPtr) const;
 
@@ -340,6 +349,9 @@ Author: Hans Ekkehard Plesser
     double operator()(void);
     double operator()(RngPtr) const;  // threaded
 
+    //! fill by calls to operator(), BaseRDV::fill() does not clip
+    void fill(RngPtr r, double* v, size_t n) const { RandomDev::fill(r, v, n); }
+
     //! set distribution parameters from SLI dict
     void set_status(const DictionaryDatum&);
 
@@ -452,6 +464,12 @@ Author: Hans Ekkehard Plesser
     double operator()(void);
     double operator()(RngPtr) const;  // threaded
 
+    //! fill by calls to operator(), BaseRDV::fill() does not clip
+    void fill(RngPtr r, double* v, size_t n) const { RandomDev::fill(r, v, n); }
+
+    //! fill by calls to ldev(), BaseRDV::fill() does not clip
+    void fill(RngPtr r, long* v, size_t n) const { RandomDev::fill(r, v, n); }
+
     long ldev(void);
     long ldev(RngPtr) const;
 
@@ -63,6 +63,8 @@ Author: Hans Ekkehard Plesser
     using RandomDev::operator();
     double operator()(RngPtr rthrd) const;   // threaded
 
+    void fill(RngPtr, double*, size_t) const; // threaded
+
     //! set distribution parameters from SLI dict
     void set_status(const DictionaryDatum&);
 
@@ -79,6 +81,15 @@ Author: Hans Ekkehard Plesser
     return -std::log(rthrd->drandpos()) / lambda_;
   }
 
+  inline
+  void ExpRandomDev::fill(RngPtr rthrd, double* v, size_t n) const
+  {
+    // 1 - U is from (0, 1], as drandpos() above
+    rthrd->fill(v, n);
+    for ( size_t i = 0 ; i < n ; ++i )
+      v[i] = -std::log(1.0 - v[i]) / lambda_;
+  }
+
 }
 
 # endif
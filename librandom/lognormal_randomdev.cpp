@@ -22,6 +22,7 @@
 
 #include <cmath>
 #include "config.h"
+#include "numerics.h"
 #include "lognormal_randomdev.h"
 #include "sliexceptions.h"
 #include "dictutils.h"
@@ -84,3 +85,19 @@ double librandom::LognormalRandomDev::operator()(RngPtr r) const
 
   return std::exp(mu_ + sigma_ * S);
 }
+
+void librandom::LognormalRandomDev::fill(RngPtr r, double* v, size_t n) const
+{
+  // Box-Muller in trigonometric form, see NormalRandomDev::fill()
+  r->fill(v, n);
+  const size_t m = n - n % 2;
+  for ( size_t i = 0 ; i < m ; i += 2 )
+  {
+    const double R = std::sqrt(-2 * std::log(1.0 - v[i]));
+    const double phi = 2 * numerics::pi * v[i+1];
+    v[i]   = std::exp(mu_ + sigma_ * R * std::cos(phi));
+    v[i+1] = std::exp(mu_ + sigma_ * R * std::sin(phi));
+  }
+  if ( m < n )
+    v[m] = (*this)(r);
+}
@@ -70,6 +70,13 @@ Author: Hans Ekkehard Plesser
     using RandomDev::operator();
     double operator()(RngPtr) const;  // threaded
 
+    /**
+     * Fill v with n numbers, threaded.
+     * Uses the trigonometric form of the Box-Muller method, which yields
+     * two numbers per pair of uniform numbers without rejection.
+     */
+    void fill(RngPtr, double*, size_t) const;
+
     //! set distribution parameters from SLI dict
     void set_status(const DictionaryDatum&);
 
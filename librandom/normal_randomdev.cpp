@@ -22,6 +22,7 @@
 
 #include <cmath>
 #include "config.h"
+#include "numerics.h"
 #include "normal_randomdev.h"
 #include "sliexceptions.h"
 #include "dictutils.h"
@@ -80,3 +81,21 @@ double librandom::NormalRandomDev::operator()(RngPtr r) const
 
   return mu_ + sigma_ * S;
 }
+
+void librandom::NormalRandomDev::fill(RngPtr r, double* v, size_t n) const
+{
+  // draw uniform numbers into v, then transform pairs in place;
+  // for odd n, the last number needs a second uniform number
+  r->fill(v, n);
+  const size_t m = n - n % 2;
+  for ( size_t i = 0 ; i < m ; i += 2 )
+  {
+    // 1 - U1 is from (0, 1]
+    const double R = std::sqrt(-2 * std::log(1.0 - v[i]));
+    const double phi = 2 * numerics::pi * v[i+1];
+    v[i]   = mu_ + sigma_ * R * std::cos(phi);
+    v[i+1] = mu_ + sigma_ * R * std::sin(phi);
+  }
+  if ( m < n )
+    v[m] = (*this)(r);
+}
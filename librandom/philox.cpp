@@ -0,0 +1,187 @@
+/*
+ *  philox.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "philox.h"
+
+const double librandom::Philox::I2DFactor_ = 1.0/4294967296.0;
+const size_t librandom::Philox::CHUNK_ = 256;
+
+librandom::Philox::Philox(unsigned long s)
+{
+  self_test_();
+  seed_(s);
+}
+
+void librandom::Philox::seed_(unsigned long s)
+{
+  const uint64_t seed = s;
+  key_[0] = static_cast<uint32_t>(seed);
+  key_[1] = static_cast<uint32_t>(seed >> 32);
+
+  std::fill(counter_, counter_ + 4, 0);
+  next_ = 4;  // block_ is empty
+}
+
+void librandom::Philox::set_substream(uint64_t key1, uint64_t key2)
+{
+  // The upper bit of the counter separates substreams from the main
+  // stream. The lower 32 bits count blocks within the substream.
+  counter_[0] = 0;
+  counter_[1] = static_cast<uint32_t>(key2);
+  counter_[2] = static_cast<uint32_t>(key1);
+  counter_[3] = 0x80000000U
+              | static_cast<uint32_t>((key1 >> 32) & 0x7fffU) << 16
+              | static_cast<uint32_t>((key2 >> 32) & 0xffffU);
+  next_ = 4;
+
+  clear_buffer_();
+}
+
+librandom::RngPtr librandom::Philox::substream(uint64_t key1, uint64_t key2) const
+{
+  Philox* rng = new Philox(0);
+  std::copy(key_, key_ + 2, rng->key_);
+  rng->set_substream(key1, key2);
+  return RngPtr(rng);
+}
+
+void librandom::Philox::philox_(const uint32_t* counter, const uint32_t* key,
+                                uint32_t* out)
+{
+  const uint32_t M0 = 0xD2511F53U;
+  const uint32_t M1 = 0xCD9E8D57U;
+  const uint32_t W0 = 0x9E3779B9U;
+  const uint32_t W1 = 0xBB67AE85U;
+
+  uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+  uint32_t k0 = key[0], k1 = key[1];
+
+  for ( int round = 0 ; round < 10 ; ++round )
+  {
+    const uint64_t p0 = static_cast<uint64_t>(M0) * c0;
+    const uint64_t p1 = static_cast<uint64_t>(M1) * c2;
+
+    c0 = static_cast<uint32_t>(p1 >> 32) ^ c1 ^ k0;
+    c2 = static_cast<uint32_t>(p0 >> 32) ^ c3 ^ k1;
+    c1 = static_cast<uint32_t>(p1);
+    c3 = static_cast<uint32_t>(p0);
+
+    k0 += W0;
+    k1 += W1;
+  }
+
+  out[0] = c0;
+  out[1] = c1;
+  out[2] = c2;
+  out[3] = c3;
+}
+
+void librandom::Philox::next_block_(uint32_t* out)
+{
+  philox_(counter_, key_, out);
+
+  // increment 128-bit counter
+  for ( int i = 0 ; i < 4 && ++counter_[i] == 0 ; ++i )
+    ;
+}
+
+void librandom::Philox::fill_raw_(uint32_t* v, size_t n)
+{
+  size_t i = 0;
+
+  // use up current block first to continue the stream seamlessly
+  while ( next_ < 4 && i < n )
+    v[i++] = block_[next_++];
+
+  for ( ; i + 4 <= n ; i += 4 )
+    next_block_(v + i);
+
+  if ( i < n )
+  {
+    next_block_(block_);
+    next_ = 0;
+    while ( i < n )
+      v[i++] = block_[next_++];
+  }
+}
+
+void librandom::Philox::fill(double* v, size_t n)
+{
+  uint32_t raw[CHUNK_];
+  for ( size_t i = 0 ; i < n ; i += CHUNK_ )
+  {
+    const size_t m = std::min(CHUNK_, n - i);
+    fill_raw_(raw, m);
+    for ( size_t j = 0 ; j < m ; ++j )
+      v[i + j] = I2DFactor_ * raw[j];
+  }
+}
+
+void librandom::Philox::fill_ulong(unsigned long* v, size_t n, unsigned long N)
+{
+  const bool small_N = N > 0 && static_cast<uint64_t>(N) - 1 <= 0xffffffffU;
+  uint32_t raw[CHUNK_];
+  for ( size_t i = 0 ; i < n ; i += CHUNK_ )
+  {
+    const size_t m = std::min(CHUNK_, n - i);
+    fill_raw_(raw, m);
+    if ( small_N )
+    {
+      // floor(N * raw / 2^32) in integer arithmetic
+      for ( size_t j = 0 ; j < m ; ++j )
+        v[i + j] = static_cast<unsigned long>((static_cast<uint64_t>(raw[j]) * N) >> 32);
+    }
+    else
+    {
+      for ( size_t j = 0 ; j < m ; ++j )
+        v[i + j] = static_cast<unsigned long>(std::floor(N * (I2DFactor_ * raw[j])));
+    }
+  }
+}
+
+void librandom::Philox::self_test_() const
+{
+  // known answers for philox4x32_10 from the Random123 distribution
+  const uint32_t counter[3][4] = {
+    { 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U },
+    { 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU },
+    { 0x243f6a88U, 0x85a308d3U, 0x13198a2eU, 0x03707344U } };
+  const uint32_t key[3][2] = {
+    { 0x00000000U, 0x00000000U },
+    { 0xffffffffU, 0xffffffffU },
+    { 0xa4093822U, 0x299f31d0U } };
+  const uint32_t expected[3][4] = {
+    { 0x6627e8d5U, 0xe169c58dU, 0xbc57ac4cU, 0x9b00dbd8U },
+    { 0x408f276dU, 0x41c83b0eU, 0xa20bc7c6U, 0x6d5451fdU },
+    { 0xd16cfe09U, 0x94fdccebU, 0x5001e420U, 0x24126ea1U } };
+
+  for ( int t = 0 ; t < 3 ; ++t )
+  {
+    uint32_t out[4];
+    philox_(counter[t], key[t], out);
+    assert(std::equal(out, out + 4, expected[t]));
+  }
+}
@@ -0,0 +1,134 @@
+/*
+ *  philox.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef PHILOX_H
+#define PHILOX_H
+
+/*
+ *  Built-in implementation of the Philox4x32-10 counter-based generator.
+ *  The generator is described in
+ *    J K Salmon, M A Moraes, R O Dror, D E Shaw, Parallel Random Numbers:
+ *    As Easy as 1, 2, 3. Proc SC11 (2011), doi:10.1145/2063384.2063405.
+ *  Results are identical to philox4x32_10 from the Random123 library.
+ */
+
+#include <stdint.h>
+
+#include "randomgen.h"
+
+namespace librandom {
+
+  /**
+   * Counter-based random number generator Philox4x32-10.
+   *
+   * Philox has no state apart from a 64-bit key and a 128-bit counter.
+   * The n-th block of four 32-bit random numbers is obtained by applying
+   * ten rounds of a bijection to counter value n. Blocks are therefore
+   * independent of each other and can be computed in bulk by fill() and
+   * fill_ulong(), bypassing the buffer of RandomGen.
+   *
+   * The key is given by the seed. A generator created from a seed
+   * delivers the main stream of that seed. Independent substreams of
+   * 2^34 numbers each can be selected by set_substream() from a pair
+   * of keys, such as the GID of a node and a time step. These allow
+   * reproducible random numbers that do not depend on the number of
+   * threads and processes: the numbers for a given (seed, gid, step)
+   * are the same, independent of the thread on which they are drawn.
+   *
+   * @ingroup RandomNumberGenerators
+   */
+  class Philox : public RandomGen {
+  public:
+
+    //! Create generator with given seed
+    explicit Philox(unsigned long);
+
+    ~Philox() {};
+
+    RngPtr clone(unsigned long s)
+      {
+	return RngPtr(new Philox(s));
+      }
+
+    //! Fill v with n numbers from [0, 1)
+    void fill(double* v, size_t n);
+
+    //! Fill v with n numbers from [0, N-1]
+    void fill_ulong(unsigned long* v, size_t n, unsigned long N);
+
+    /**
+     * Switch to the beginning of the substream given by two keys.
+     * Only the lower 47 bits of key1 and 48 bits of key2 are used.
+     * Numbers already buffered by RandomGen are discarded.
+     */
+    void set_substream(uint64_t key1, uint64_t key2);
+
+    /**
+     * Create new generator for substream of this generator.
+     * @see set_substream()
+     */
+    RngPtr substream(uint64_t key1, uint64_t key2) const;
+
+  private:
+    //! implements seeding for RandomGen
+    void   seed_(unsigned long);
+
+    //! implements drawing a single [0,1) number for RandomGen
+    double drand_();
+
+  private:
+    static const double I2DFactor_; //!< int to double factor
+    static const size_t CHUNK_;     //!< numbers generated at once by fill()
+
+    //! Compute the Philox4x32-10 bijection of counter for given key
+    static void philox_(const uint32_t* counter, const uint32_t* key,
+                        uint32_t* out);
+
+    //! Compute block of four numbers for counter_ and advance counter_
+    void next_block_(uint32_t*);
+
+    //! Fill v with n raw 32-bit numbers, continuing from block_
+    void fill_raw_(uint32_t* v, size_t n);
+
+    //! Compare with known results of Random123, breaks assertion on failure
+    void self_test_() const;
+
+    uint32_t key_[2];      //!< key, set from seed
+    uint32_t counter_[4];  //!< counter of next block
+    uint32_t block_[4];    //!< current block
+    unsigned int next_;    //!< next number in block_ to deliver
+  };
+
+  inline
+  double Philox::drand_()
+  {
+    if ( next_ == 4 )
+    {
+      next_block_(block_);
+      next_ = 0;
+    }
+    return I2DFactor_ * block_[next_++];
+  }
+
+}
+
+#endif
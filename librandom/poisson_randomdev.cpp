@@ -296,6 +296,57 @@ long librandom::PoissonRandomDev::ldev(RngPtr r) const
 
 }
 
+void librandom::PoissonRandomDev::fill(RngPtr r, long* v, size_t n) const
+{
+  assert(r.valid());
+
+  if ( mu_ == 0.0 )
+  {
+    std::fill(v, v + n, 0L);
+    return;
+  }
+
+  if ( mu_ >= 10.0 )
+  {
+    for ( size_t i = 0 ; i < n ; ++i )
+      v[i] = ldev(r);
+    return;
+  }
+
+  // Case B in Ahrens & Dieter, in blocks: draw all uniform numbers
+  // of a block, then invert them by table lookup
+  const size_t block = 64;
+  double U[block];
+  for ( size_t b = 0 ; b < n ; b += block )
+  {
+    const size_t m = std::min(block, n - b);
+    for ( size_t i = 0 ; i < m ; ++i )
+      U[i] = (*r)();
+
+    for ( size_t i = 0 ; i < m ; ++i )
+    {
+      unsigned long K = 0;
+      while ( U[i] > P_[K] && K != n_tab_ )
+        ++K;
+      v[b + i] = K;
+    }
+  }
+}
+
+void librandom::PoissonRandomDev::fill(RngPtr r, double* v, size_t n) const
+{
+  // generate integers in blocks, then convert
+  const size_t block = 64;
+  long K[block];
+  for ( size_t b = 0 ; b < n ; b += block )
+  {
+    const size_t m = std::min(block, n - b);
+    fill(r, K, m);
+    for ( size_t i = 0 ; i < m ; ++i )
+      v[b + i] = K[i];
+  }
+}
+
 void librandom::PoissonRandomDev::proc_f_(const unsigned K, 
 					  double &px, double &py, 
 					  double &fx, double &fy) const
@@ -135,6 +135,16 @@ Author: Hans Ekkehard Plesser
     long ldev(RngPtr) const;   //!< draw integer, threaded
     bool has_ldev() const { return true; }
 
+    /**
+     * Draw n integers into v, threaded.
+     * For lambda < 10, uniform numbers are drawn in blocks first and then
+     * inverted by table lookup, so that the loops are free of dependencies
+     * between draws. Otherwise, equivalent to n calls to ldev().
+     */
+    void fill(RngPtr, long* v, size_t n) const;
+
+    void fill(RngPtr, double*, size_t) const;  //!< fill as double, threaded
+
     double operator()(RngPtr) const;     //!< return as double, threaded
 
   private:
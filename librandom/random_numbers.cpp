@@ -20,6 +20,8 @@
  *
  */
 
+#include <vector>
+
 #include "config.h"
 #include "dict.h"
 #include "dictdatum.h"
@@ -34,6 +36,7 @@
 #include "random_datums.h"
 #include "knuthlfg.h"
 #include "mt19937.h"
+#include "philox.h"
 #include "gslrandomgen.h"
 #include "clipped_randomdev.h"
 
@@ -112,6 +115,7 @@ void RandomNumbers::init(SLIInterpreter *i)
   // add built-in rngs
   register_rng_<librandom::KnuthLFG>("knuthlfg", *rngdict_);
   register_rng_<librandom::MT19937>("MT19937", *rngdict_);
+  register_rng_<librandom::Philox>("Philox4x32", *rngdict_);
 
   // let GslRandomGen add all of the GSL rngs
   librandom::GslRandomGen::add_gsl_rngs(*rngdict_);
@@ -286,12 +290,23 @@ void RandomNumbers::RandomArrayFunction::execute(SLIInterpreter *i) const
   TokenArray result;
   result.reserve(n);
 
+  // draw all numbers at once, so that deviates can transform in bulk
   if ( rdv->has_ldev() )
+  {
+    std::vector<long> v(n);
+    if ( n > 0 )
+      rdv->fill(&v[0], n);
     for( long j = 0; j < n ; ++j)
-      result.push_back(rdv->ldev());
+      result.push_back(v[j]);
+  }
   else
+  {
+    std::vector<double> v(n);
+    if ( n > 0 )
+      rdv->fill(&v[0], n);
     for( long j=0; j<n ; ++j)
-      result.push_back( (*rdv)() );
+      result.push_back(v[j]);
+  }
   
   i->OStack.pop(2);
   i->OStack.push(ArrayDatum(result));
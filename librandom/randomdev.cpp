@@ -22,9 +22,21 @@
 
 #include "randomdev.h"
 
+void librandom::RandomDev::fill(RngPtr r, double* v, size_t n) const
+{
+  for ( size_t i = 0 ; i < n ; ++i )
+    v[i] = (*this)(r);
+}
+
 long librandom::RandomDev::ldev(RngPtr) const
 {
   assert(false);
   return 0;
 }
 
+void librandom::RandomDev::fill(RngPtr r, long* v, size_t n) const
+{
+  for ( size_t i = 0 ; i < n ; ++i )
+    v[i] = ldev(r);
+}
+
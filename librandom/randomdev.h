@@ -155,12 +155,41 @@ namespace librandom {
     virtual double operator()(void);   //!< single-threaded
     virtual double operator()(RngPtr) const = 0; //!< multi-threaded
 
+    /**
+     * Fill v with n numbers, multi-threaded.
+     *
+     * The default implementation calls operator()(RngPtr) n times.
+     * Deviates that can transform uniform numbers in bulk override
+     * this function, drawing all uniform numbers with RandomGen::fill()
+     * first, and transforming them in loops without dependencies between
+     * iterations. The numbers follow the same distribution as those
+     * from operator(), but need not be the same sequence.
+     */
+    virtual void fill(RngPtr, double* v, size_t n) const;
+
+    /**
+     * Fill v with n numbers, single-threaded.
+     */
+    void fill(double* v, size_t n);
+
     /**
      * integer valued functions for discrete distributions
      */
     virtual long ldev(void);
     virtual long ldev(RngPtr) const;
 
+    /**
+     * Fill v with n integers, multi-threaded.
+     *
+     * The default implementation calls ldev(RngPtr) n times.
+     */
+    virtual void fill(RngPtr, long* v, size_t n) const;
+
+    /**
+     * Fill v with n integers, single-threaded.
+     */
+    void fill(long* v, size_t n);
+
     /**
      * true if RDG implements ldev function
      */
@@ -209,6 +238,20 @@ namespace librandom {
     return this->ldev(rng_);
   }
 
+  inline
+  void RandomDev::fill(double* v, size_t n)
+  {
+    assert(rng_.valid());
+    fill(rng_, v, n);
+  }
+
+  inline
+  void RandomDev::fill(long* v, size_t n)
+  {
+    assert(rng_.valid());
+    fill(rng_, v, n);
+  }
+
 
   /**
    * Generic factory class for RandomDev.
@@ -74,6 +74,18 @@ void librandom::RandomGen::refill_(void)
   next_ = buffer_.begin();
 }
 
+void librandom::RandomGen::fill(double* v, size_t n)
+{
+  for ( size_t i = 0 ; i < n ; ++i )
+    v[i] = drand();
+}
+
+void librandom::RandomGen::fill_ulong(unsigned long* v, size_t n, unsigned long N)
+{
+  for ( size_t i = 0 ; i < n ; ++i )
+    v[i] = ulrand(N);
+}
+
 librandom::RngPtr librandom::RandomGen::create_knuthlfg_rng(unsigned long seed)
 {
   return librandom::RngPtr(new librandom::KnuthLFG(seed));
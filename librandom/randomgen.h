@@ -112,6 +112,8 @@
  *        ()                   [0, 1)                            
  * double drandpos()           (0, 1)                            
  * ulong  ulrand(N)            [0, N-1]                          
+ * void   fill(v, n)          n numbers from [0, 1) into v
+ * void   fill_ulong(v, n, N) n numbers from [0, N-1] into v
  *                                                          
  * void   seed(N)              seed the RNG, N: ulong            
  *                                                          
@@ -135,12 +137,13 @@
  * @note
  * For a list of available RNGs, see rngdict info in SLI.
  *
- * NEST comes at present with two built-in random number generators:
+ * NEST comes at present with three built-in random number generators:
  * - knuthlfg, the lagged Fibonacci generator from D.E.Knuth,
  *   The Art of Computer Programming, 3rd ed, vol 2, sec 3.6.
  * - MT19937, the Mersenne Twister by Matsumoto and Nishimura.
- * Implementations of both are directly derived from free code published
- * by the original authors.
+ * - Philox4x32, the counter-based generator by Salmon et al.
+ * Implementations of the first two are directly derived from free code
+ * published by the original authors.
  *
  * If the GNU Scientific Library (v 1.2 or later) is installed,
  * all uniform random number generators from the GSL are made available,
@@ -267,6 +270,16 @@ namespace librandom {
 
     void seed(const unsigned long);   //!< set random seed to a new value 
 
+    /**
+     * Fill v with n numbers from [0, 1).
+     * The default implementation calls drand() n times. Generators that
+     * can produce numbers in bulk more efficiently override it.
+     */
+    virtual void fill(double* v, size_t n);
+
+    //! Fill v with n numbers from [0, N-1], as by n calls to ulrand(N)
+    virtual void fill_ulong(unsigned long* v, size_t n, unsigned long N);
+
     size_t get_buffsize(void) const;  //!< returns buffer size
     void set_buffsize(const size_t);  //!< set buffer size
 
@@ -294,6 +307,9 @@ namespace librandom {
     virtual void seed_(unsigned long) =0;  //!< seeding interface
     virtual double drand_() =0;            //!< drawing interface
 
+    //! Discard buffered numbers, e.g., after a derived class changed its state
+    void clear_buffer_();
+
   private:
 
     void refill_();    //!< refill buffer
@@ -371,6 +387,12 @@ namespace librandom {
     return static_cast<unsigned long>(std::floor(n * drand()));
   }
 
+  inline
+  void RandomGen::clear_buffer_()
+  {
+    next_ = end_;
+  }
+
   inline 
   size_t RandomGen::get_buffsize(void) const
   {
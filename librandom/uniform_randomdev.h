@@ -80,6 +80,8 @@ Author: Hans Ekkehard Plesser
     using RandomDev::operator();
     double operator()(RngPtr rthrd) const;   // threaded
 
+    void fill(RngPtr, double*, size_t) const; // threaded
+
     //! set distribution parameters from SLI dict
     void set_status(const DictionaryDatum&);
 
@@ -98,6 +100,14 @@ Author: Hans Ekkehard Plesser
     return low_ + delta_ * rthrd->drand();
   }
 
+  inline
+  void UniformRandomDev::fill(RngPtr rthrd, double* v, size_t n) const
+  {
+    rthrd->fill(v, n);
+    for ( size_t i = 0 ; i < n ; ++i )
+      v[i] = low_ + delta_ * v[i];
+  }
+
 }
 # endif
 
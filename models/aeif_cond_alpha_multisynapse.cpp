@@ -76,6 +76,7 @@ namespace nest
       I_e(0.0),  // pA
       MAXERR(1.0e-10), // mV
       HMIN(1.0e-3),    // ms
+      num_of_receptors_(0),
       has_connections_(false)
   {
     taus_syn.clear();
@@ -366,8 +367,7 @@ namespace nest
 
   void aeif_cond_alpha_multisynapse::init_buffers_()
   {
-    B_.spike_exc_.clear();          // includes resize
-    B_.spike_inh_.clear();          // includes resize
+    B_.spikes_.clear();             // includes resize
     B_.currents_.clear();           // includes resize
     Archiving_Node::clear_history();
 
@@ -402,8 +402,7 @@ namespace nest
     V_.RefractoryCounts_ = Time(Time::ms(P_.t_ref_)).get_steps();
     assert(V_.RefractoryCounts_ >= 0); // since t_ref_ >= 0, this can only fail in error
 
-    B_.spike_exc_.resize(P_.num_of_receptors_);
-    B_.spike_inh_.resize(P_.num_of_receptors_);
+    B_.spikes_.resize(2 * P_.num_of_receptors_);
     S_.y_.resize(
         State_::NUMBER_OF_FIXED_STATES_ELEMENTS
             + (State_::NUMBER_OF_STATES_ELEMENTS_PER_RECEPTOR
@@ -612,15 +611,18 @@ namespace nest
         }
       } //while
 
+      // input of all receptors for this step is contiguous
+      const double_t* const spikes = B_.spikes_.get_values(lag);
       for (size_t i = 0; i < P_.num_of_receptors_; ++i)
       {
         S_.y_[State_::DG_EXC
             + (State_::NUMBER_OF_STATES_ELEMENTS_PER_RECEPTOR * i)] +=
-            B_.spike_exc_[i].get_value(lag) * V_.g0_ex_[i]; // add incoming spikes
+            spikes[2 * i] * V_.g0_ex_[i]; // add incoming spikes
         S_.y_[State_::DG_INH
             + (State_::NUMBER_OF_STATES_ELEMENTS_PER_RECEPTOR * i)] +=
-            B_.spike_inh_[i].get_value(lag) * V_.g0_in_[i];
+            spikes[2 * i + 1] * V_.g0_in_[i];
       }
+      B_.spikes_.reset_values(lag);
       // set new input current
       B_.I_stim_ = B_.currents_.get_value(lag);
 
@@ -648,14 +650,16 @@ namespace nest
 
     if (e.get_weight() > 0.0)
     {
-      B_.spike_exc_[e.get_rport() - 1].add_value(
+      B_.spikes_.add_value(
           e.get_rel_delivery_steps(network()->get_slice_origin()),
+          2 * (e.get_rport() - 1),
           e.get_weight() * e.get_multiplicity());
     }
     else
     {
-      B_.spike_inh_[e.get_rport() - 1].add_value(
+      B_.spikes_.add_value(
           e.get_rel_delivery_steps(network()->get_slice_origin()),
+          2 * (e.get_rport() - 1) + 1,
           -e.get_weight() * e.get_multiplicity()); // keep conductances positive
     }
   }
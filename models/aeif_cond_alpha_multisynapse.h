@@ -237,8 +237,11 @@ namespace nest
       UniversalDataLogger<aeif_cond_alpha_multisynapse> logger_;
 
       /** buffers and sums up incoming spikes/currents */
-      std::vector<RingBuffer> spike_exc_;
-      std::vector<RingBuffer> spike_inh_;
+      /** 
+       * Excitatory and inhibitory input of all receptors: channel 2*i
+       * holds excitatory, channel 2*i+1 inhibitory input to receptor i+1.
+       */
+      MultiChannelRingBuffer spikes_;
       RingBuffer currents_;
 
       // IntergrationStep_ should be reset with the neuron on ResetNetwork,
@@ -39,6 +39,7 @@ nest::gamma_sup_generator::Internal_states_::Internal_states_(size_t num_bins, u
 {
     occ_.resize(num_bins, ini_occ_ref);
     occ_.back() += ini_occ_act;
+    n_trans_.resize(num_bins, 0);
 }
 
 /* ---------------------------------------------------------------- 
@@ -47,8 +48,8 @@ nest::gamma_sup_generator::Internal_states_::Internal_states_(size_t num_bins, u
 
 nest::ulong_t nest::gamma_sup_generator::Internal_states_::update(double_t transition_prob, librandom::RngPtr rng)
 {
-    std::vector<ulong_t> n_trans;  // only set from poisson_dev_ og bino_dev_ or 0, thus >= 0
-    n_trans.resize( occ_.size() );
+    // n_trans_ is only set from poisson_dev_ or bino_dev_ or 0, thus >= 0
+    std::vector<ulong_t>& n_trans = n_trans_;
     
     // go through all states and draw number of transitioning components
     for (ulong_t i=0; i<occ_.size(); i++)
@@ -208,6 +209,24 @@ void nest::gamma_sup_generator::update(Time const & T, const long_t from, const
   if ( P_.rate_ <= 0 || P_.num_targets_ == 0 ) 
     return;
 
+  // Draw the spike counts of all targets for all active lags of the slice
+  // before sending, so that event_hook() only needs to look them up. Lags
+  // are traversed in the outer loop, so that random numbers are consumed
+  // in the same order as when drawing them one by one in event_hook().
+  const size_t n_targets = B_.internal_states_.size();
+  B_.n_spikes_.resize( (to - from) * n_targets );
+  librandom::RngPtr rng = net_->get_rng(get_thread());
+
+  for ( long_t lag = from ; lag < to ; ++lag )
+  {
+    if ( !device_.is_active( T + Time::step(lag) ) )
+      continue;
+
+    ulong_t* const n_spikes = &B_.n_spikes_[(lag - from) * n_targets];
+    for ( size_t prt = 0 ; prt < n_targets ; ++prt )
+      n_spikes[prt] = B_.internal_states_[prt].update( V_.transition_prob_, rng );
+  }
+
   for ( long_t lag = from ; lag < to ; ++lag )
   {
     Time t = T + Time::step(lag); 
@@ -215,6 +234,7 @@ void nest::gamma_sup_generator::update(Time const & T, const long_t from, const
     if ( !device_.is_active( t ) )
       continue;  // no spike at this lag
     
+    V_.n_spikes_offset_ = (lag - from) * n_targets;
     DSSpikeEvent se;
     network()->send(*this, se, lag);
   }
@@ -230,8 +250,8 @@ void nest::gamma_sup_generator::event_hook(DSSpikeEvent& e)
   // we handle only one port here, get reference to vector elem
   assert(0 <= prt && static_cast<size_t>(prt) < B_.internal_states_.size() );
 
-  // age_distribution object propagates one time step and returns number of spikes
-  ulong_t n_spikes = B_.internal_states_[prt].update( V_.transition_prob_, net_->get_rng(get_thread()) );
+  // number of spikes was drawn for all targets in update()
+  const ulong_t n_spikes = B_.n_spikes_[V_.n_spikes_offset_ + prt];
   
   if ( n_spikes > 0 ) // we must not send events with multiplicity 0
   {
@@ -143,6 +143,7 @@ namespace nest{
       librandom::BinomialRandomDev bino_dev_;       //!< random deviate generator
       librandom::PoissonRandomDev poisson_dev_;     //!< random deviate generator
       std::vector<ulong_t> occ_;                    //!< occupation numbers of internal states
+      std::vector<ulong_t> n_trans_;                //!< scratch space for transition numbers
       
       public:
       Internal_states_(size_t num_bins, ulong_t ini_occ_ref, ulong_t ini_occ_act);  //!< initialize occupation numbers
@@ -157,6 +158,13 @@ namespace nest{
        */
 
       std::vector<Internal_states_> internal_states_;
+
+      /**
+       * Spike counts for all targets at all lags of the current slice,
+       * drawn in update(). The count for port prt at lag is stored at
+       * (lag - from) * num_targets + prt.
+       */
+      std::vector<ulong_t> n_spikes_;
       
     };
 
@@ -177,6 +185,7 @@ namespace nest{
       //@{
       double_t t_min_active_;  //!< start of generator activity in slice 
       double_t t_max_active_;  //!< end of generator activity in slice 
+      size_t n_spikes_offset_; //!< index of counts for current lag in B_.n_spikes_
       //@}
     };
 
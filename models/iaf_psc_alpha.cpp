@@ -30,6 +30,7 @@
 #include "numerics.h"
 #include "universal_data_logger_impl.h"
 
+#include <cmath>
 #include <limits>
 
 nest::RecordablesMap<nest::iaf_psc_alpha> nest::iaf_psc_alpha::recordablesMap_;
@@ -66,7 +67,11 @@ namespace nest
       Theta_     (-55.0-U0_),  // mV, rel to U0_
       LowerBound_(-std::numeric_limits<double_t>::infinity()),
       tau_ex_    (  2.0    ),  // ms
-      tau_in_    (  2.0    )   // ms
+      tau_in_    (  2.0    ),  // ms
+      bg_rate_ex_  (  0.0  ),  // Hz
+      bg_rate_in_  (  0.0  ),  // Hz
+      bg_weight_ex_(  0.0  ),  // pA
+      bg_weight_in_(  0.0  )   // pA
   {}
 
   iaf_psc_alpha::State_::State_()
@@ -95,6 +100,10 @@ namespace nest
     def<double>(d, names::t_ref, TauR_);
     def<double>(d, names::tau_syn_ex, tau_ex_);
     def<double>(d, names::tau_syn_in, tau_in_);
+    def<double>(d, names::bg_rate_ex, bg_rate_ex_);
+    def<double>(d, names::bg_rate_in, bg_rate_in_);
+    def<double>(d, names::bg_weight_ex, bg_weight_ex_);
+    def<double>(d, names::bg_weight_in, bg_weight_in_);
   }
 
   double iaf_psc_alpha::Parameters_::set(const DictionaryDatum& d)
@@ -125,6 +134,10 @@ namespace nest
     updateValue<double>(d, names::tau_syn_ex, tau_ex_);
     updateValue<double>(d, names::tau_syn_in, tau_in_);
     updateValue<double>(d, names::t_ref, TauR_);
+    updateValue<double>(d, names::bg_rate_ex, bg_rate_ex_);
+    updateValue<double>(d, names::bg_rate_in, bg_rate_in_);
+    updateValue<double>(d, names::bg_weight_ex, bg_weight_ex_);
+    updateValue<double>(d, names::bg_weight_in, bg_weight_in_);
 
     if ( C_ <= 0.0 )
       throw BadProperty("Capacitance must be > 0.");
@@ -144,9 +157,25 @@ namespace nest
     if ( V_reset_ >= Theta_ )
       throw BadProperty("Reset potential must be smaller than threshold.");
 
+    if ( bg_rate_ex_ < 0.0 || bg_rate_in_ < 0.0 )
+      throw BadProperty("Background rates cannot be negative.");
+
+    if ( bg_weight_ex_ < 0.0 || bg_weight_in_ > 0.0 )
+      throw BadProperty("Background weights must be non-negative for excitatory "
+                        "and non-positive for inhibitory input.");
+
     return delta_EL;
   }
 
+  bool iaf_psc_alpha::Parameters_::operator==(const Parameters_& p) const
+  {
+    return Tau_ == p.Tau_ && C_ == p.C_ && TauR_ == p.TauR_ && U0_ == p.U0_
+      && I_e_ == p.I_e_ && V_reset_ == p.V_reset_ && Theta_ == p.Theta_
+      && LowerBound_ == p.LowerBound_ && tau_ex_ == p.tau_ex_ && tau_in_ == p.tau_in_
+      && bg_rate_ex_ == p.bg_rate_ex_ && bg_rate_in_ == p.bg_rate_in_
+      && bg_weight_ex_ == p.bg_weight_ex_ && bg_weight_in_ == p.bg_weight_in_;
+  }
+
   void iaf_psc_alpha::State_::get(DictionaryDatum &d, const Parameters_& p) const
   {
     def<double>(d, names::V_m, y3_ + p.U0_); // Membrane potential
@@ -161,11 +190,15 @@ namespace nest
   }
 
   iaf_psc_alpha::Buffers_::Buffers_(iaf_psc_alpha& n)
-    : logger_(n)
+    : bg_wait_ex_(-1.0),
+      bg_wait_in_(-1.0),
+      logger_(n)
   {}
 
   iaf_psc_alpha::Buffers_::Buffers_(const Buffers_ &, iaf_psc_alpha& n)
-    : logger_(n)
+    : bg_wait_ex_(-1.0),
+      bg_wait_in_(-1.0),
+      logger_(n)
   {}
 
 
@@ -201,8 +234,8 @@ namespace nest
 
   void iaf_psc_alpha::init_buffers_()
   {
-    B_.ex_spikes_.clear();       // includes resize
-    B_.in_spikes_.clear();       // includes resize
+    B_.spikes_.resize(Buffers_::NUM_SPIKE_CHANNELS);
+    B_.spikes_.clear();          // includes resize
     B_.currents_.clear();        // includes resize
 
     B_.logger_.reset();
@@ -217,28 +250,28 @@ namespace nest
     const double h = Time::get_resolution().get_ms();
 
     // these P are independent
-    V_.P11_ex_ = V_.P22_ex_ = std::exp(-h/P_.tau_ex_);
-    V_.P11_in_ = V_.P22_in_ = std::exp(-h/P_.tau_in_);
+    V_.P11_ex_ = V_.P22_ex_ = std::exp(-h/P_->tau_ex_);
+    V_.P11_in_ = V_.P22_in_ = std::exp(-h/P_->tau_in_);
 
-    V_.P33_ = std::exp(-h/P_.Tau_);
+    V_.P33_ = std::exp(-h/P_->Tau_);
 
-    V_.expm1_tau_m_ = numerics::expm1(-h/P_.Tau_);
+    V_.expm1_tau_m_ = numerics::expm1(-h/P_->Tau_);
 
     // these depend on the above. Please do not change the order.
-    V_.P30_ = -P_.Tau_/P_.C_*numerics::expm1(-h/P_.Tau_);
+    V_.P30_ = -P_->Tau_/P_->C_*numerics::expm1(-h/P_->Tau_);
 
     V_.P21_ex_ = h * V_.P11_ex_;
-    V_.P31_ex_ = 1/P_.C_ * ((V_.P11_ex_-V_.P33_)/(-1/P_.tau_ex_- -1/P_.Tau_)- h*V_.P11_ex_)
-      /(-1/P_.Tau_ - -1/P_.tau_ex_);
-    V_.P32_ex_ = 1/P_.C_*(V_.P33_-V_.P11_ex_)/(-1/P_.Tau_ - -1/P_.tau_ex_);
+    V_.P31_ex_ = 1/P_->C_ * ((V_.P11_ex_-V_.P33_)/(-1/P_->tau_ex_- -1/P_->Tau_)- h*V_.P11_ex_)
+      /(-1/P_->Tau_ - -1/P_->tau_ex_);
+    V_.P32_ex_ = 1/P_->C_*(V_.P33_-V_.P11_ex_)/(-1/P_->Tau_ - -1/P_->tau_ex_);
 
     V_.P21_in_ = h * V_.P11_in_;
-    V_.P31_in_ = 1/P_.C_ * ((V_.P11_in_-V_.P33_)/(-1/P_.tau_in_- -1/P_.Tau_)- h*V_.P11_in_)
-      /(-1/P_.Tau_ - -1/P_.tau_in_);
-    V_.P32_in_ = 1/P_.C_*(V_.P33_-V_.P11_in_)/(-1/P_.Tau_ - -1/P_.tau_in_);
+    V_.P31_in_ = 1/P_->C_ * ((V_.P11_in_-V_.P33_)/(-1/P_->tau_in_- -1/P_->Tau_)- h*V_.P11_in_)
+      /(-1/P_->Tau_ - -1/P_->tau_in_);
+    V_.P32_in_ = 1/P_->C_*(V_.P33_-V_.P11_in_)/(-1/P_->Tau_ - -1/P_->tau_in_);
 
-    V_.EPSCInitialValue_=1.0 * numerics::e/P_.tau_ex_;
-    V_.IPSCInitialValue_=1.0 * numerics::e/P_.tau_in_;
+    V_.EPSCInitialValue_=1.0 * numerics::e/P_->tau_ex_;
+    V_.IPSCInitialValue_=1.0 * numerics::e/P_->tau_in_;
 
     // TauR specifies the length of the absolute refractory period as
     // a double_t in ms. The grid based iaf_psc_alpha can only handle refractory
@@ -260,8 +293,18 @@ namespace nest
     // results. However, a neuron model capable of operating with real valued spike
     // time may exhibit a different effective refractory time.
 
-    V_.RefractoryCounts_ = Time(Time::ms(P_.TauR_)).get_steps();
+    V_.RefractoryCounts_ = Time(Time::ms(P_->TauR_)).get_steps();
     assert(V_.RefractoryCounts_ >= 0);  // since t_ref_ >= 0, this can only fail in error
+
+    // rates are in Hz, h in ms, so we have to convert from s to ms;
+    // intervals are only used if the rate is positive
+    V_.bg_interval_ex_ = P_->bg_rate_ex_ > 0.0 ? 1e3 / (h * P_->bg_rate_ex_) : 0.0;
+    V_.bg_interval_in_ = P_->bg_rate_in_ > 0.0 ? 1e3 / (h * P_->bg_rate_in_) : 0.0;
+
+    // intervals are memoryless, so the next spikes can be drawn anew
+    // with the current rates
+    B_.bg_wait_ex_ = -1.0;
+    B_.bg_wait_in_ = -1.0;
   }
 
   /* ----------------------------------------------------------------
@@ -273,18 +316,37 @@ namespace nest
     assert(to >= 0 && (delay) from < Scheduler::get_min_delay());
     assert(from < to);
 
+    const bool bg_ex = P_->bg_rate_ex_ > 0.0;
+    const bool bg_in = P_->bg_rate_in_ > 0.0;
+    librandom::RandomGen* rng = 0;
+    if ( bg_ex || bg_in )
+      rng = &*network()->get_rng(get_thread());
+
     for ( long_t lag = from ; lag < to ; ++lag )
     {
+      // excitatory and inhibitory input of this step are adjacent in memory
+      const double_t* const weighted_spikes = B_.spikes_.get_values(lag);
+      V_.weighted_spikes_ex_ = weighted_spikes[Buffers_::EXC];
+      V_.weighted_spikes_in_ = weighted_spikes[Buffers_::INH];
+      B_.spikes_.reset_values(lag);
+
+      if ( bg_ex )
+        V_.weighted_spikes_ex_ += P_->bg_weight_ex_
+          * bg_spikes_(*rng, B_.bg_wait_ex_, V_.bg_interval_ex_);
+      if ( bg_in )
+        V_.weighted_spikes_in_ += P_->bg_weight_in_
+          * bg_spikes_(*rng, B_.bg_wait_in_, V_.bg_interval_in_);
+
       if ( S_.r_ == 0 )
       {
         // neuron not refractory
-        S_.y3_ = V_.P30_*(S_.y0_ + P_.I_e_)
+        S_.y3_ = V_.P30_*(S_.y0_ + P_->I_e_)
                  + V_.P31_ex_ * S_.y1_ex_ + V_.P32_ex_ * S_.y2_ex_
                  + V_.P31_in_ * S_.y1_in_ + V_.P32_in_ * S_.y2_in_
                  + V_.expm1_tau_m_ * S_.y3_ + S_.y3_;
 
         // lower bound of membrane potential
-        S_.y3_ = ( S_.y3_ < P_.LowerBound_ ? P_.LowerBound_ : S_.y3_);
+        S_.y3_ = ( S_.y3_ < P_->LowerBound_ ? P_->LowerBound_ : S_.y3_);
       }
       else // neuron is absolute refractory
         --S_.r_;
@@ -295,7 +357,6 @@ namespace nest
 
       // Apply spikes delivered in this step; spikes arriving at T+1 have
       // an immediate effect on the state of the neuron
-      V_.weighted_spikes_ex_ = B_.ex_spikes_.get_value(lag);
       S_.y1_ex_ += V_.EPSCInitialValue_ * V_.weighted_spikes_ex_;
 
       // alpha shape EPSCs
@@ -304,14 +365,13 @@ namespace nest
 
       // Apply spikes delivered in this step; spikes arriving at T+1 have
       // an immediate effect on the state of the neuron
-      V_.weighted_spikes_in_ = B_.in_spikes_.get_value(lag);
       S_.y1_in_ += V_.IPSCInitialValue_ * V_.weighted_spikes_in_;
 
       // threshold crossing
-      if ( S_.y3_ >= P_.Theta_)
+      if ( S_.y3_ >= P_->Theta_)
       {
         S_.r_  = V_.RefractoryCounts_;
-        S_.y3_ = P_.V_reset_;
+        S_.y3_ = P_->V_reset_;
         // A supra-threshold membrane potential should never be observable.
         // The reset at the time of threshold crossing enables accurate integration
         // independent of the computation step size, see [2,3] for details.
@@ -329,16 +389,30 @@ namespace nest
     }
   }
 
+  long iaf_psc_alpha::bg_spikes_(librandom::RandomGen& rng, double_t& wait,
+                                 const double_t interval)
+  {
+    if ( wait < 0.0 )
+      wait = -interval * std::log(rng.drandpos());
+
+    long n = 0;
+    while ( wait < 1.0 )
+    {
+      ++n;
+      wait -= interval * std::log(rng.drandpos());
+    }
+    wait -= 1.0;
+    return n;
+  }
+
   void iaf_psc_alpha::handle(SpikeEvent& e)
   {
     assert(e.get_delay() > 0);
 
     const double_t s = e.get_weight() * e.get_multiplicity();
 
-    if(e.get_weight() > 0.0)
-      B_.ex_spikes_.add_value(e.get_rel_delivery_steps(network()->get_slice_origin()), s);
-    else
-      B_.in_spikes_.add_value(e.get_rel_delivery_steps(network()->get_slice_origin()), s);
+    B_.spikes_.add_value(e.get_rel_delivery_steps(network()->get_slice_origin()),
+                         e.get_weight() > 0.0 ? Buffers_::EXC : Buffers_::INH, s);
   }
 
   void iaf_psc_alpha::handle(CurrentEvent& e)
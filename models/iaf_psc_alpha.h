@@ -30,6 +30,8 @@
 #include "connection.h"
 #include "universal_data_logger.h"
 #include "recordables_map.h"
+#include "shared_parameters.h"
+#include "randomgen.h"
 
 /* BeginDocumentation
 Name: iaf_psc_alpha - Leaky integrate-and-fire neuron model.
@@ -95,12 +97,30 @@ Parameters:
   tau_syn_in double - Rise time of the inhibitory synaptic alpha function in ms.
   I_e        double - Constant external input current in pA.
   V_min      double - Absolute lower value for the membrane potential.
+
+  bg_rate_ex   double - Rate of excitatory Poisson background input in Hz.
+  bg_weight_ex double - Weight of excitatory background input spikes in pA,
+                        must not be negative.
+  bg_rate_in   double - Rate of inhibitory Poisson background input in Hz.
+  bg_weight_in double - Weight of inhibitory background input spikes in pA,
+                        must not be positive.
  
 Note:
   tau_m != tau_syn_{ex,in} is required by the current implementation to avoid a
   degenerate case of the ODE describing the model [1]. For very similar values,
   numerics will be unstable.
 
+  Background input:
+  The bg_* parameters provide each neuron with private excitatory and
+  inhibitory Poisson input, drawn by the neuron itself in update() as the
+  exponentially distributed intervals between input spikes. This is
+  statistically equivalent to connecting a poisson_generator with rate
+  bg_rate_ex (bg_rate_in) to each neuron by a static_synapse with weight
+  bg_weight_ex (bg_weight_in), but avoids sending one event per generator,
+  target and time step. Background input is not delayed, and it does not
+  appear in the spike input of other models. Rates are 0 by default, and
+  neurons without background input draw no random numbers.
+
 References:
   [1] Rotter S & Diesmann M (1999) Exact simulation of time-invariant linear
       systems with applications to neuronal modeling. Biologial Cybernetics
@@ -154,6 +174,7 @@ namespace nest
 
     void get_status(DictionaryDatum &) const;
     void set_status(const DictionaryDatum &);
+    const void* get_shared_parameters(size_t &, long &) const;
 
   private:
 
@@ -163,6 +184,14 @@ namespace nest
 
     void update(Time const &, const long_t, const long_t);
 
+    /**
+     * Return the number of background input spikes in the next step.
+     * wait is the time until the next spike in steps, and is advanced by
+     * one step. Intervals are drawn from the exponential distribution
+     * with the given mean.
+     */
+    static long bg_spikes_(librandom::RandomGen&, double_t& wait, double_t interval);
+
     // The next two classes need to be friends to access the State_ class/member
     friend class RecordablesMap<iaf_psc_alpha>;
     friend class UniversalDataLogger<iaf_psc_alpha>;
@@ -202,6 +231,14 @@ namespace nest
 
       /** Time constant of inhibitory synaptic current in ms. */
       double_t tau_in_;
+
+      /** Rates of excitatory and inhibitory Poisson background input in Hz. */
+      double_t bg_rate_ex_;
+      double_t bg_rate_in_;
+
+      /** Weights of excitatory and inhibitory background input spikes in pA. */
+      double_t bg_weight_ex_;
+      double_t bg_weight_in_;
       
       Parameters_();  //!< Sets default parameter values
 
@@ -212,6 +249,8 @@ namespace nest
        */
       double set(const DictionaryDatum&);
 
+      bool operator==(const Parameters_&) const;
+
     };
     
     // ---------------------------------------------------------------- 
@@ -247,11 +286,17 @@ namespace nest
       Buffers_(iaf_psc_alpha&);
       Buffers_(const Buffers_&, iaf_psc_alpha&);
 
+      //! Input channels of spikes_
+      enum SpikeChannels_ { EXC = 0, INH, NUM_SPIKE_CHANNELS };
+
       /** buffers and summs up incoming spikes/currents */
-      RingBuffer ex_spikes_;
-      RingBuffer in_spikes_;
+      MultiChannelRingBuffer spikes_;  //!< excitatory and inhibitory spikes
       RingBuffer currents_;
 
+      //! Steps until the next background input spike, negative if not drawn yet
+      double_t bg_wait_ex_;
+      double_t bg_wait_in_;
+
       //! Logger for all analog data
       UniversalDataLogger<iaf_psc_alpha> logger_;
 
@@ -286,13 +331,16 @@ namespace nest
       double_t weighted_spikes_ex_;
       double_t weighted_spikes_in_;
 
+      //! Mean interval between background input spikes in steps
+      double_t bg_interval_ex_;
+      double_t bg_interval_in_;
 
     };
 
     // Access functions for UniversalDataLogger -------------------------------
 
     //! Read out the real membrane potential
-    double_t get_V_m_() const { return S_.y3_ + P_.U0_; }
+    double_t get_V_m_() const { return S_.y3_ + P_->U0_; }
 
     double_t get_weighted_spikes_ex_() const { return V_.weighted_spikes_ex_; }
     double_t get_weighted_spikes_in_() const { return V_.weighted_spikes_in_; }
@@ -308,7 +356,7 @@ namespace nest
      * @note The order of definitions is important for speed.
      * @{
      */   
-    Parameters_ P_;
+    SharedParameters<Parameters_> P_;  //!< Parameters, possibly shared with other nodes
     State_      S_;
     Variables_  V_;
     Buffers_    B_;
@@ -354,8 +402,8 @@ namespace nest
   inline
   void iaf_psc_alpha::get_status(DictionaryDatum &d) const
   {
-    P_.get(d);
-    S_.get(d, P_);
+    P_->get(d);
+    S_.get(d, *P_);
     Archiving_Node::get_status(d);
   
     (*d)[names::recordables] = recordablesMap_.get_list();
@@ -364,7 +412,7 @@ namespace nest
   inline
   void iaf_psc_alpha::set_status(const DictionaryDatum &d)
   {
-    Parameters_ ptmp = P_;            // temporary copy in case of errors
+    Parameters_ ptmp = *P_;            // temporary copy in case of errors
     const double delta_EL = ptmp.set(d);         // throws if BadProperty
     State_      stmp = S_;            // temporary copy in case of errors
     stmp.set(d, ptmp, delta_EL);                 // throws if BadProperty
@@ -376,10 +424,18 @@ namespace nest
     Archiving_Node::set_status(d);
   
     // if we get here, temporaries contain consistent set of properties
-    P_ = ptmp;
+    P_.set(ptmp);
     S_ = stmp;
   }
 
+  inline
+  const void* iaf_psc_alpha::get_shared_parameters(size_t &size, long &saving) const
+  {
+    size = P_.block_size();
+    saving = P_.handle_saving();
+    return P_.id();
+  }
+
 } // namespace
 
 #endif /* #ifndef IAF_PSC_ALPHA_H */
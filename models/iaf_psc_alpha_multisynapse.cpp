@@ -64,6 +64,7 @@ iaf_psc_alpha_multisynapse::Parameters_::Parameters_()
     V_reset_             (-70.0-U0_),  // mV, rel to U0_
     Theta_               (-55.0-U0_),  // mV, rel to U0_
     LowerBound_          (-std::numeric_limits<double_t>::infinity()),
+    num_of_receptors_    ( 0       ),
     has_connections_     ( false   )
 {
   tau_syn_.clear();  
@@ -258,7 +259,6 @@ void iaf_psc_alpha_multisynapse::calibrate()
     V_.P32_syn_[i] = 1/P_.C_*(V_.P33_-V_.P11_syn_[i])/(-1/P_.Tau_ - -1/P_.tau_syn_[i]);
 
     V_.PSCInitialValues_[i] = 1.0 * numerics::e/P_.tau_syn_[i];
-    B_.spikes_[i].resize();
   }
   
   Time r=Time::ms(P_.TauR_);
@@ -292,6 +292,8 @@ void iaf_psc_alpha_multisynapse::update(Time const& origin, const long_t from, c
     else // neuron is absolute refractory
       --S_.r_;
 
+    // input of all receptors for this step is contiguous
+    const double_t* const spikes = B_.spikes_.get_values(lag);
     for (size_t i=0; i < P_.num_of_receptors_; i++)
     {      
       // alpha shape PSCs
@@ -299,8 +301,9 @@ void iaf_psc_alpha_multisynapse::update(Time const& origin, const long_t from, c
       S_.y1_syn_[i] *= V_.P11_syn_[i];
 
       // collect spikes
-      S_.y1_syn_[i] += V_.PSCInitialValues_[i] * B_.spikes_[i].get_value(lag);   
+      S_.y1_syn_[i] += V_.PSCInitialValues_[i] * spikes[i];
     }
+    B_.spikes_.reset_values(lag);
 
     if (S_.y3_ >= P_.Theta_)  // threshold crossing
     {
@@ -336,13 +339,11 @@ void iaf_psc_alpha_multisynapse::handle(SpikeEvent& e)
 {
   assert(e.get_delay() > 0);
 
-  for (size_t i=0; i < P_.num_of_receptors_; ++i)
-  {
-    if (P_.receptor_types_[i] == e.get_rport()){
-      B_.spikes_[i].add_value(e.get_rel_delivery_steps(network()->get_slice_origin()),
-			   e.get_weight() * e.get_multiplicity());
-    }
-  }
+  assert(e.get_rport() > 0 && (size_t)e.get_rport() <= P_.num_of_receptors_);
+
+  // receptor types are numbered from 1, channels from 0
+  B_.spikes_.add_value(e.get_rel_delivery_steps(network()->get_slice_origin()),
+                       e.get_rport() - 1, e.get_weight() * e.get_multiplicity());
 }
 
 void iaf_psc_alpha_multisynapse::handle(CurrentEvent& e)
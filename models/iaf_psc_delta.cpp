@@ -136,6 +136,13 @@ double nest::iaf_psc_delta::Parameters_::set(const DictionaryDatum& d)
   return delta_EL;
 }
 
+bool nest::iaf_psc_delta::Parameters_::operator==(const Parameters_& p) const
+{
+  return tau_m_ == p.tau_m_ && c_m_ == p.c_m_ && t_ref_ == p.t_ref_ && E_L_ == p.E_L_
+    && I_e_ == p.I_e_ && V_th_ == p.V_th_ && V_min_ == p.V_min_ && V_reset_ == p.V_reset_
+    && with_refr_input_ == p.with_refr_input_;
+}
+
 void nest::iaf_psc_delta::State_::get(DictionaryDatum &d, const Parameters_& p) const
 {
   def<double>(d, names::V_m, y3_ + p.E_L_); // Membrane potential
@@ -202,8 +209,8 @@ void nest::iaf_psc_delta::calibrate()
   const double h = Time::get_resolution().get_ms(); 
 
  
-  V_.P33_ = std::exp(-h/P_.tau_m_);
-  V_.P30_ = 1/P_.c_m_*(1-V_.P33_)*P_.tau_m_;
+  V_.P33_ = std::exp(-h/P_->tau_m_);
+  V_.P30_ = 1/P_->c_m_*(1-V_.P33_)*P_->tau_m_;
 
 
   // TauR specifies the length of the absolute refractory period as 
@@ -227,7 +234,7 @@ void nest::iaf_psc_delta::calibrate()
   // time may exhibit a different effective refractory time.
   //
   
-  V_.RefractoryCounts_ = Time(Time::ms(P_.t_ref_)).get_steps();
+  V_.RefractoryCounts_ = Time(Time::ms(P_->t_ref_)).get_steps();
   assert(V_.RefractoryCounts_ >= 0);  // since t_ref_ >= 0, this can only fail in error
 }
 
@@ -247,26 +254,26 @@ void nest::iaf_psc_delta::update(Time const & origin,
     if ( S_.r_ == 0 )
     {
       // neuron not refractory
-      S_.y3_ = V_.P30_*(S_.y0_ + P_.I_e_) + V_.P33_*S_.y3_ + B_.spikes_.get_value(lag);
+      S_.y3_ = V_.P30_*(S_.y0_ + P_->I_e_) + V_.P33_*S_.y3_ + B_.spikes_.get_value(lag);
 
       // if we have accumulated spikes from refractory period, 
       // add and reset accumulator
-      if ( P_.with_refr_input_ && S_.refr_spikes_buffer_ != 0.0 )
+      if ( P_->with_refr_input_ && S_.refr_spikes_buffer_ != 0.0 )
       {
 	S_.y3_ += S_.refr_spikes_buffer_;
 	S_.refr_spikes_buffer_ = 0.0;
       }
       
       // lower bound of membrane potential
-      S_.y3_ = ( S_.y3_<P_.V_min_ ? P_.V_min_ : S_.y3_); 	 
+      S_.y3_ = ( S_.y3_<P_->V_min_ ? P_->V_min_ : S_.y3_); 	 
     }
     else // neuron is absolute refractory
     {
       // read spikes from buffer and accumulate them, discounting
       // for decay until end of refractory period
-      if ( P_.with_refr_input_ )
+      if ( P_->with_refr_input_ )
 	S_.refr_spikes_buffer_ += B_.spikes_.get_value(lag)
-	  * std::exp(-S_.r_ * h / P_.tau_m_);
+	  * std::exp(-S_.r_ * h / P_->tau_m_);
       else
 	B_.spikes_.get_value(lag);  // clear buffer entry, ignore spike
 
@@ -274,10 +281,10 @@ void nest::iaf_psc_delta::update(Time const & origin,
     }
    
     // threshold crossing
-    if (S_.y3_ >= P_.V_th_)
+    if (S_.y3_ >= P_->V_th_)
     {
       S_.r_ = V_.RefractoryCounts_;
-      S_.y3_ = P_.V_reset_;
+      S_.y3_ = P_->V_reset_;
         
       // EX: must compute spike time
       set_spiketime(Time::step(origin.get_steps()+lag+1));
@@ -29,6 +29,7 @@
 #include "ring_buffer.h"
 #include "connection.h"
 #include "universal_data_logger.h"
+#include "shared_parameters.h"
 
 namespace nest{
   
@@ -152,6 +153,7 @@ namespace nest{
 
     void get_status(DictionaryDatum &) const;
     void set_status(const DictionaryDatum &);
+    const void* get_shared_parameters(size_t &, long &) const;
 
   private:
 
@@ -207,6 +209,8 @@ namespace nest{
        * @returns Change in reversal potential E_L, to be passed to State_::set()
        */
        double set(const DictionaryDatum&);
+
+      bool operator==(const Parameters_&) const;
     };
     
     // ---------------------------------------------------------------- 
@@ -271,7 +275,7 @@ namespace nest{
     // Access functions for UniversalDataLogger -------------------------------
 
     //! Read out the real membrane potential
-    double_t get_V_m_() const { return S_.y3_ + P_.E_L_; }
+    double_t get_V_m_() const { return S_.y3_ + P_->E_L_; }
 
     // ---------------------------------------------------------------- 
 
@@ -282,7 +286,7 @@ namespace nest{
      * @note The order of definitions is important for speed.
      * @{
      */   
-    Parameters_ P_;
+    SharedParameters<Parameters_> P_;  //!< Parameters, possibly shared with other nodes
     State_      S_;
     Variables_  V_;
     Buffers_    B_;
@@ -329,8 +333,8 @@ port iaf_psc_delta::handles_test_event(DataLoggingRequest& dlr,
 inline
 void iaf_psc_delta::get_status(DictionaryDatum &d) const
 {
-  P_.get(d);
-  S_.get(d, P_);
+  P_->get(d);
+  S_.get(d, *P_);
   Archiving_Node::get_status(d);
   (*d)[names::recordables] = recordablesMap_.get_list();
 }
@@ -338,7 +342,7 @@ void iaf_psc_delta::get_status(DictionaryDatum &d) const
 inline
 void iaf_psc_delta::set_status(const DictionaryDatum &d)
 {
-  Parameters_ ptmp = P_;  // temporary copy in case of errors
+  Parameters_ ptmp = *P_;  // temporary copy in case of errors
   const double delta_EL = ptmp.set(d); // throws if BadProperty
   State_      stmp = S_;  // temporary copy in case of errors
   stmp.set(d, ptmp, delta_EL);         // throws if BadProperty
@@ -350,10 +354,18 @@ void iaf_psc_delta::set_status(const DictionaryDatum &d)
   Archiving_Node::set_status(d);
 
   // if we get here, temporaries contain consistent set of properties
-  P_ = ptmp;
+  P_.set(ptmp);
   S_ = stmp;
 }
 
+inline
+const void* iaf_psc_delta::get_shared_parameters(size_t &size, long &saving) const
+{
+  size = P_.block_size();
+  saving = P_.handle_saving();
+  return P_.id();
+}
+
 } // namespace
 
 #endif /* #ifndef IAF_PSC_DELTA_H */
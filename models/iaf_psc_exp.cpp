@@ -138,6 +138,13 @@ double nest::iaf_psc_exp::Parameters_::set(const DictionaryDatum &d)
   return delta_EL;
 }
 
+bool nest::iaf_psc_exp::Parameters_::operator==(const Parameters_ &p) const
+{
+  return Tau_ == p.Tau_ && C_ == p.C_ && t_ref_ == p.t_ref_ && U0_ == p.U0_
+    && I_e_ == p.I_e_ && Theta_ == p.Theta_ && V_reset_ == p.V_reset_
+    && tau_ex_ == p.tau_ex_ && tau_in_ == p.tau_in_;
+}
+
 void nest::iaf_psc_exp::State_::get(DictionaryDatum &d, const Parameters_ &p) const
 {
   def<double>(d, names::V_m, V_m_ + p.U0_); // Membrane potential
@@ -213,25 +220,25 @@ void nest::iaf_psc_exp::calibrate()
   // needed to exactly reproduce Tsodyks network
  
   // these P are independent
-  V_.P11ex_ = std::exp(-h/P_.tau_ex_);
+  V_.P11ex_ = std::exp(-h/P_->tau_ex_);
   //P11ex_ = 1.0-h/tau_ex_;
 
-  V_.P11in_ = std::exp(-h/P_.tau_in_);
+  V_.P11in_ = std::exp(-h/P_->tau_in_);
   //P11in_ = 1.0-h/tau_in_;
 
-  V_.P22_ = std::exp(-h/P_.Tau_);
+  V_.P22_ = std::exp(-h/P_->Tau_);
   //P22_ = 1.0-h/Tau_;
 
   // these depend on the above. Please do not change the order.
   // TODO: use expm1 here to improve accuracy for small timesteps
 
-  V_.P21ex_ = P_.Tau_/(P_.C_*(1.0-P_.Tau_/P_.tau_ex_)) * V_.P11ex_ * (1.0 - std::exp(h*(1.0/P_.tau_ex_-1.0/P_.Tau_)));
+  V_.P21ex_ = P_->Tau_/(P_->C_*(1.0-P_->Tau_/P_->tau_ex_)) * V_.P11ex_ * (1.0 - std::exp(h*(1.0/P_->tau_ex_-1.0/P_->Tau_)));
   //P21ex_ = h/C_;
 
-  V_.P21in_ = P_.Tau_/(P_.C_*(1.0-P_.Tau_/P_.tau_in_)) * V_.P11in_ * (1.0 - std::exp(h*(1.0/P_.tau_in_-1.0/P_.Tau_)));
+  V_.P21in_ = P_->Tau_/(P_->C_*(1.0-P_->Tau_/P_->tau_in_)) * V_.P11in_ * (1.0 - std::exp(h*(1.0/P_->tau_in_-1.0/P_->Tau_)));
   //P21in_ = h/C_;
 
-  V_.P20_ = P_.Tau_/P_.C_*(1.0 - V_.P22_);
+  V_.P20_ = P_->Tau_/P_->C_*(1.0 - V_.P22_);
   //P20_ = h/C_;
 
   // TauR specifies the length of the absolute refractory period as 
@@ -252,7 +259,7 @@ void nest::iaf_psc_exp::calibrate()
   // time may exhibit a different effective refractory time.
   //
  
-  V_.RefractoryCounts_ = Time(Time::ms(P_.t_ref_)).get_steps();
+  V_.RefractoryCounts_ = Time(Time::ms(P_->t_ref_)).get_steps();
   assert(V_.RefractoryCounts_ >= 0);  // since t_ref_ >= 0, this can only fail in error
 }
 
@@ -265,7 +272,7 @@ void nest::iaf_psc_exp::update(const Time &origin, const long_t from, const long
   for ( long_t lag = from; lag < to; ++lag )
   {	
     if ( S_.r_ref_ == 0 ) // neuron not refractory, so evolve V
-      S_.V_m_ = S_.V_m_*V_.P22_ + S_.i_syn_ex_*V_.P21ex_ + S_.i_syn_in_*V_.P21in_ + (P_.I_e_+S_.i_0_)*V_.P20_; 
+      S_.V_m_ = S_.V_m_*V_.P22_ + S_.i_syn_ex_*V_.P21ex_ + S_.i_syn_in_*V_.P21in_ + (P_->I_e_+S_.i_0_)*V_.P20_; 
     else 
       --S_.r_ref_; // neuron is absolute refractory
 
@@ -284,10 +291,10 @@ void nest::iaf_psc_exp::update(const Time &origin, const long_t from, const long
     S_.i_syn_ex_ += V_.weighted_spikes_ex_;
     S_.i_syn_in_ += V_.weighted_spikes_in_;
                                                        
-    if ( S_.V_m_ >= P_.Theta_ )  // threshold crossing
+    if ( S_.V_m_ >= P_->Theta_ )  // threshold crossing
     {
       S_.r_ref_ = V_.RefractoryCounts_;
-      S_.V_m_ = P_.V_reset_;
+      S_.V_m_ = P_->V_reset_;
         
       set_spiketime(Time::step(origin.get_steps()+lag+1));
 	    
@@ -30,6 +30,7 @@
 #include "connection.h"
 #include "universal_data_logger.h"
 #include "recordables_map.h"
+#include "shared_parameters.h"
 
 namespace nest
 {
@@ -147,6 +148,7 @@ namespace nest
 
     void get_status(DictionaryDatum &) const;
     void set_status(const DictionaryDatum &);
+    const void* get_shared_parameters(size_t &, long &) const;
 
   private:
 
@@ -204,6 +206,8 @@ namespace nest
        * @returns Change in reversal potential E_L, to be passed to State_::set()
        */
       double set(const DictionaryDatum&);
+
+      bool operator==(const Parameters_&) const;
     };
     
     // ---------------------------------------------------------------- 
@@ -284,7 +288,7 @@ namespace nest
     // Access functions for UniversalDataLogger -------------------------------
 
     //! Read out the real membrane potential
-    double_t get_V_m_() const { return S_.V_m_ + P_.U0_; }
+    double_t get_V_m_() const { return S_.V_m_ + P_->U0_; }
     
     double_t get_weighted_spikes_ex_() const { return V_.weighted_spikes_ex_; }
     double_t get_weighted_spikes_in_() const { return V_.weighted_spikes_in_; }
@@ -300,7 +304,7 @@ namespace nest
      * @note The order of definitions is important for speed.
      * @{
      */   
-    Parameters_ P_;
+    SharedParameters<Parameters_> P_;  //!< Parameters, possibly shared with other nodes
     State_      S_;
     Variables_  V_;
     Buffers_    B_;
@@ -350,8 +354,8 @@ port iaf_psc_exp::handles_test_event(DataLoggingRequest& dlr,
   inline
   void iaf_psc_exp::get_status(DictionaryDatum &d) const
   {
-    P_.get(d);
-    S_.get(d, P_);
+    P_->get(d);
+    S_.get(d, *P_);
     Archiving_Node::get_status(d);
 
     (*d)[names::recordables] = recordablesMap_.get_list();
@@ -360,7 +364,7 @@ port iaf_psc_exp::handles_test_event(DataLoggingRequest& dlr,
   inline
   void iaf_psc_exp::set_status(const DictionaryDatum &d)
   {
-    Parameters_ ptmp = P_;  // temporary copy in case of errors
+    Parameters_ ptmp = *P_;  // temporary copy in case of errors
     const double delta_EL = ptmp.set(d);                       // throws if BadProperty
     State_      stmp = S_;  // temporary copy in case of errors
     stmp.set(d, ptmp, delta_EL);                 // throws if BadProperty
@@ -372,10 +376,18 @@ port iaf_psc_exp::handles_test_event(DataLoggingRequest& dlr,
     Archiving_Node::set_status(d);
 
     // if we get here, temporaries contain consistent set of properties
-    P_ = ptmp;
+    P_.set(ptmp);
     S_ = stmp;
   }
 
+  inline
+  const void* iaf_psc_exp::get_shared_parameters(size_t &size, long &saving) const
+  {
+    size = P_.block_size();
+    saving = P_.handle_saving();
+    return P_.id();
+  }
+
 } // namespace
 
 #endif // IAF_PSC_EXP_H
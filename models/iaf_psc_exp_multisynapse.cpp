@@ -62,6 +62,7 @@ iaf_psc_exp_multisynapse::Parameters_::Parameters_()
     I_e_             (   0.0       ),  // in pA
     V_reset_         ( -70.0 - U0_ ),  // in mV
     Theta_           ( -55.0 - U0_ ),  // relative U0_
+    num_of_receptors_( 0           ),
     has_connections_ ( false       )
 {
   tau_syn_.clear();  
@@ -238,7 +239,6 @@ void nest::iaf_psc_exp_multisynapse::calibrate()
     V_.P11_syn_[i] = std::exp(-h/P_.tau_syn_[i]);
     V_.P21_syn_[i] = P_.Tau_/(P_.C_*(1.0-P_.Tau_/P_.tau_syn_[i])) * V_.P11_syn_[i] * (1.0 - std::exp(h*(1.0/P_.tau_syn_[i]-1.0/P_.Tau_)));
 
-    B_.spikes_[i].resize();
   }
 
   V_.RefractoryCounts_ = Time(Time::ms(P_.t_ref_)).get_steps();
@@ -268,14 +268,17 @@ void iaf_psc_exp_multisynapse::update(const Time& origin, const long_t from, con
     else 
       --S_.r_ref_; // neuron is absolute refractory
 
+    // input of all receptors for this step is contiguous
+    const double_t* const spikes = B_.spikes_.get_values(lag);
     for (size_t i=0; i < P_.num_of_receptors_; i++)
     {      
       // exponential decaying PSCs
       S_.i_syn_[i] *= V_.P11_syn_[i];
 
       // collect spikes
-      S_.i_syn_[i] += B_.spikes_[i].get_value(lag);   // not sure about this
+      S_.i_syn_[i] += spikes[i];   // not sure about this
     }
+    B_.spikes_.reset_values(lag);
 
     if (S_.V_m_ >= P_.Theta_)  // threshold crossing
     {
@@ -308,13 +311,11 @@ void iaf_psc_exp_multisynapse::handle(SpikeEvent& e)
 {
   assert(e.get_delay() > 0);
 
-  for (size_t i=0; i < P_.num_of_receptors_; ++i)
-  {
-    if (P_.receptor_types_[i] == e.get_rport()){
-      B_.spikes_[i].add_value(e.get_rel_delivery_steps(network()->get_slice_origin()),
-			   e.get_weight() * e.get_multiplicity());
-    }
-  }
+  assert(e.get_rport() > 0 && (size_t)e.get_rport() <= P_.num_of_receptors_);
+
+  // receptor types are numbered from 1, channels from 0
+  B_.spikes_.add_value(e.get_rel_delivery_steps(network()->get_slice_origin()),
+                       e.get_rport() - 1, e.get_weight() * e.get_multiplicity());
 }
 
 void iaf_psc_exp_multisynapse::handle(CurrentEvent& e)
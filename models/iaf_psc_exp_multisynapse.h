@@ -179,7 +179,7 @@ namespace nest
       Buffers_(const Buffers_ &, iaf_psc_exp_multisynapse &);
 
       /** buffers and sums up incoming spikes/currents */
-      std::vector<RingBuffer> spikes_;
+      MultiChannelRingBuffer spikes_;  //!< one channel per receptor
       RingBuffer currents_;
 
       //! Logger for all analog data
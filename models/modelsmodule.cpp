@@ -39,6 +39,8 @@
 #include "network.h"
 #include "model.h"
 #include "genericmodel.h"
+#include "interpret.h"
+#include "arraydatum.h"
 #include <string>
 
 // Neuron models
@@ -149,8 +151,56 @@ namespace nest
 
   //-------------------------------------------------------------------------------------
 
-  void ModelsModule::init(SLIInterpreter *)
+  /* BeginDocumentation
+     Name: SetSpikeTrains - set the spike times of many spike generators at once
+
+     Synopsis:
+     gids times SetSpikeTrains -> -
+
+     Parameters:
+     gids  - array or IntVector of spike generator GIDs, one per spike
+     times - array or DoubleVector of spike times in ms, one per spike
+
+     Description:
+     Sets the spike times of all spike generators that appear in gids.
+     The generator gids[i] emits a spike at times[i]. The spike times of
+     each generator must be sorted, but spikes of different generators
+     may be interleaved. Each generator converts its spike times according
+     to its own options, as if they were set with SetStatus. Spike weights
+     are cleared.
+
+     This is much faster than setting the spike times of each generator
+     with SetStatus when loading many spike trains, and the spike data of
+     all generators are stored only once instead of once per thread.
+     If any GID is not a spike_generator or any spike time is invalid,
+     no generator is changed.
+
+     Example:
+     /spike_generator 2 Create ;
+     [1 2 1] [1.0 2.0 3.0] SetSpikeTrains
+
+     Availability: NEST
+     SeeAlso: spike_generator, SetStatus
+  */
+  void ModelsModule::SetSpikeTrains_iv_dvFunction::execute(SLIInterpreter *i) const
   {
+    i->assert_stack_load(2);
+
+    IntVectorDatum gids = getValue<IntVectorDatum>(i->OStack.pick(1));
+    DoubleVectorDatum times = getValue<DoubleVectorDatum>(i->OStack.pick(0));
+
+    spike_generator::set_spike_trains(*gids, *times);
+
+    i->OStack.pop(2);
+    i->EStack.pop();
+  }
+
+  //-------------------------------------------------------------------------------------
+
+  void ModelsModule::init(SLIInterpreter *i)
+  {
+    i->createcommand("SetSpikeTrains_iv_dv", &setspiketrains_iv_dvfunction);
+
     register_model<iaf_neuron>(net_,                 "iaf_neuron");
     register_model<iaf_chs_2007>(net_,               "iaf_chs_2007");
     register_model<iaf_psc_alpha>(net_,              "iaf_psc_alpha");
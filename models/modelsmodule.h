@@ -24,6 +24,7 @@
 #define MODELSMODULE_H
 
 #include "slimodule.h"
+#include "slifunction.h"
 
 namespace nest
 {
@@ -50,6 +51,12 @@ namespace nest
      const std::string name(void) const;
      const std::string commandstring(void) const;
 
+     class SetSpikeTrains_iv_dvFunction: public SLIFunction
+     {
+     public:
+       void execute(SLIInterpreter *) const;
+     } setspiketrains_iv_dvfunction;
+
    private:
      
      //! network where models are to be registered
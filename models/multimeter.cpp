@@ -66,7 +66,10 @@ namespace nest
   }
 
   nest::Multimeter::Buffers_::Buffers_()
-    : has_targets_(false)
+    : has_targets_(false),
+      frames_(),
+      n_frames_(0),
+      fbuf_()
   {
   }
 
@@ -122,6 +125,7 @@ namespace nest
   void Multimeter::init_buffers_()
   {
     device_.init_buffers();
+    B_.n_frames_ = 0;
   }
   
   void Multimeter::calibrate()
@@ -129,6 +133,9 @@ namespace nest
     device_.calibrate();
     V_.new_request_ = false;
     V_.current_request_data_start_ = 0;
+
+    if ( to_binary_file_() )
+      write_binary_header_();
   }
 
   void Multimeter::finalize()
@@ -161,6 +168,10 @@ namespace nest
     V_.new_request_ = B_.has_targets_ && !P_.record_from_.empty();  // no targets, no request
     DataLoggingRequest req;
     network()->send(*this, req);
+
+    // all replies have been handled when send() returns
+    if ( to_binary_file_() )
+      write_binary_frames_();
   }
 
   void Multimeter::handle(DataLoggingReply &reply)
@@ -201,6 +212,9 @@ namespace nest
 
         if ( device_.to_memory() )
           S_.data_.push_back(info[j].data);
+
+        if ( to_binary_file_() )
+          add_to_frame_(reply.get_sender_gid(), info[j]);
       }
       else
       {
@@ -247,10 +261,104 @@ namespace nest
         if ( device_.to_accumulator() && not dv.empty() )
           accumulate_property(d, P_.record_from_[v], dv);
         else
-          append_property(d, P_.record_from_[v], dv);
+          move_property(d, P_.record_from_[v], dv);
       }
   }
 
+  void Multimeter::take_events(DictionaryDatum& d)
+  {
+    device_.take_events(d);
+    add_data_(d);
+    S_.data_.clear();
+
+    // if we are the device on thread 0, also take the data from the
+    // siblings on other threads
+    if (get_thread() == 0)
+    {
+      const SiblingContainer* siblings = network()->get_thread_siblings(get_gid());
+      std::vector<Node*>::const_iterator sibling;
+      for (sibling = siblings->begin() + 1; sibling != siblings->end(); ++sibling)
+        (*sibling)->take_events(d);
+    }
+  }
+
+  bool Multimeter::to_binary_file_() const
+  {
+    return device_.to_file() && device_.binary();
+  }
+
+  void Multimeter::add_to_frame_(index gid, const DataLoggingReply::Item& item)
+  {
+    // All nodes reply with the same time stamps, so the frame is usually
+    // found within the first few entries.
+    size_t f = 0;
+    while ( f < B_.n_frames_ && B_.frames_[f].stamp_ != item.timestamp )
+      ++f;
+
+    if ( f == B_.n_frames_ )
+    {
+      if ( B_.n_frames_ == B_.frames_.size() )
+        B_.frames_.push_back(Buffers_::Frame_());
+
+      Buffers_::Frame_& frame = B_.frames_[B_.n_frames_++];
+      frame.stamp_ = item.timestamp;
+      frame.gids_.clear();   // clear() keeps capacity
+      frame.data_.clear();
+    }
+
+    Buffers_::Frame_& frame = B_.frames_[f];
+    frame.gids_.push_back(gid);
+    frame.data_.insert(frame.data_.end(), item.data.begin(), item.data.end());
+  }
+
+  void Multimeter::write_binary_header_()
+  {
+    if ( !device_.file_is_empty() )
+      return;   // header has been written before
+
+    std::vector<char>& buf = B_.fbuf_;
+    buf.clear();
+
+    const char magic[8] = { 'N', 'E', 'S', 'T', 'M', 'M', 'F', 1 };
+    buf.insert(buf.end(), magic, magic + 8);
+    RecordingDevice::append_binary(buf, static_cast<unsigned int>(0x01020304));
+    RecordingDevice::append_binary(buf, static_cast<unsigned int>(sizeof(long_t)));
+    RecordingDevice::append_binary(buf, static_cast<unsigned int>(sizeof(double_t)));
+    RecordingDevice::append_binary(buf, static_cast<unsigned int>(P_.record_from_.size()));
+    RecordingDevice::append_binary(buf, P_.interval_.get_ms());
+    for ( size_t j = 0 ; j < P_.record_from_.size() ; ++j )
+    {
+      const std::string& name = P_.record_from_[j].toString();
+      RecordingDevice::append_binary(buf, static_cast<unsigned int>(name.size()));
+      buf.insert(buf.end(), name.begin(), name.end());
+    }
+
+    device_.write_to_file(&buf[0], buf.size());
+  }
+
+  void Multimeter::write_binary_frames_()
+  {
+    if ( B_.n_frames_ == 0 )
+      return;
+
+    std::vector<char>& buf = B_.fbuf_;
+    buf.clear();
+
+    const long_t n_vars = P_.record_from_.size();
+    for ( size_t f = 0 ; f < B_.n_frames_ ; ++f )
+    {
+      const Buffers_::Frame_& frame = B_.frames_[f];
+      RecordingDevice::append_binary(buf, frame.stamp_.get_ms());
+      RecordingDevice::append_binary(buf, static_cast<long_t>(frame.gids_.size()));
+      RecordingDevice::append_binary(buf, n_vars);
+      RecordingDevice::append_binary(buf, frame.gids_);
+      RecordingDevice::append_binary(buf, frame.data_);
+    }
+
+    device_.write_to_file(&buf[0], buf.size());
+    B_.n_frames_ = 0;
+  }
+
   bool Multimeter::is_active(Time const & T) const
   {
     const long_t stamp = T.get_steps();
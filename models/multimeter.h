@@ -69,6 +69,34 @@ to memory, to screen, with GID or with weight. You must activate accumulator mod
 before simulating. Accumulator data is never written to file. You must extract it
 from the device using GetStatus.
 
+Binary output:
+If /to_file and /binary are set, the multimeter writes a binary stream of
+frames instead of ASCII lines. This is much more compact and faster to write
+when recording from many neurons at small intervals; combine it with
+/to_memory false to avoid collecting the data in memory as well. All values
+are written in the native byte order and sizes of the machine; the file
+header allows readers to check these. The file consists of
+
+ file header:  char[8]       magic "NESTMMF" followed by format version (1)
+               unsigned int  0x01020304, to determine byte order
+               unsigned int  sizeof(long), sizeof(double)
+               unsigned int  number of recorded variables n_vars
+               double        recording interval in ms
+               n_vars times: unsigned int  length of name, followed by the
+                                           characters of the name from 
+                                           /record_from (no trailing 0)
+ frames:       double        time stamp in ms
+               long          number of nodes n_nodes
+               long          number of values per node, n_vars
+               long[n_nodes] GIDs of the recorded nodes
+               double[n_nodes * n_vars]  values, node by node in the order 
+                                         of the GIDs; for each node in the
+                                         order of /record_from
+
+There is one frame per recorded time stamp. All frames collected during one
+time slice are written in a single block. As for ASCII output, there is one
+file per virtual process.
+
 Note:
  - The set of variables to record and the recording interval must be set
    BEFORE the multimeter is connected to any node, and cannot be changed
@@ -179,6 +207,7 @@ namespace nest {
 
     void get_status(DictionaryDatum &) const;
     void set_status(const DictionaryDatum &) ;
+    void take_events(DictionaryDatum &);
 
   protected:
     void init_state_(Node const&);
@@ -219,6 +248,26 @@ namespace nest {
      */
     void add_data_(DictionaryDatum&) const;
 
+    /**
+     * Return true if data is written as binary frames to file.
+     */
+    bool to_binary_file_() const;
+
+    /**
+     * Add data from one reply item to the binary frame for its time stamp.
+     */
+    void add_to_frame_(index, const DataLoggingReply::Item&);
+
+    /**
+     * Write file header for binary output, if the file is new.
+     */
+    void write_binary_header_();
+
+    /**
+     * Write all binary frames collected since the last call to file.
+     */
+    void write_binary_frames_();
+
     // ------------------------------------------------------------
 
     RecordingDevice device_;
@@ -263,6 +312,24 @@ namespace nest {
       Buffers_();
 
       bool has_targets_;
+
+      /**
+       * Data recorded from all nodes at one time stamp, for binary output.
+       */
+      struct Frame_ {
+        Time                  stamp_;  //!< time stamp of data
+        std::vector<long_t>   gids_;   //!< GIDs of nodes that replied
+        std::vector<double_t> data_;   //!< values, node by node
+      };
+
+      /** Frames collected during the current round of replies.
+       * Frames are re-used to avoid re-allocation, only the first 
+       * n_frames_ are valid.
+       */
+      std::vector<Frame_> frames_;
+      size_t n_frames_;           //!< number of valid entries in frames_
+
+      std::vector<char> fbuf_;   //!< frames serialized for writing
     };
 
     // ------------------------------------------------------------
@@ -219,6 +219,14 @@ void nest::ppd_sup_generator::update(Time const & T, const long_t from, const lo
   if ( P_.rate_ <= 0 || P_.num_targets_ == 0 ) 
     return;
 
+  // Draw the spike counts of all targets for all active lags of the slice
+  // before sending, so that event_hook() only needs to look them up. Lags
+  // are traversed in the outer loop, so that random numbers are consumed
+  // in the same order as when drawing them one by one in event_hook().
+  const size_t n_targets = B_.age_distributions_.size();
+  B_.n_spikes_.resize( (to - from) * n_targets );
+  librandom::RngPtr rng = net_->get_rng(get_thread());
+
   for ( long_t lag = from ; lag < to ; ++lag )
   {
     Time t = T + Time::step(lag); 
@@ -234,7 +242,18 @@ void nest::ppd_sup_generator::update(Time const & T, const long_t from, const lo
     }   
     else
       V_.hazard_step_t_ = V_.hazard_step_;    
-    
+
+    ulong_t* const n_spikes = &B_.n_spikes_[(lag - from) * n_targets];
+    for ( size_t prt = 0 ; prt < n_targets ; ++prt )
+      n_spikes[prt] = B_.age_distributions_[prt].update( V_.hazard_step_t_, rng );
+  }
+
+  for ( long_t lag = from ; lag < to ; ++lag )
+  {
+    if ( !device_.is_active( T + Time::step(lag) ) )
+      continue;
+
+    V_.n_spikes_offset_ = (lag - from) * n_targets;
     DSSpikeEvent se;
     network()->send(*this, se, lag);
   }
@@ -249,8 +268,8 @@ void nest::ppd_sup_generator::event_hook(DSSpikeEvent& e)
   // we handle only one port here, get reference to vector element 
   assert(0 <= prt && static_cast<size_t>(prt) < B_.age_distributions_.size() );
 
-  // age_distribution object propagates one time step and returns number of spikes
-  ulong_t n_spikes = B_.age_distributions_[prt].update( V_.hazard_step_t_, net_->get_rng(get_thread()) );
+  // number of spikes was drawn for all targets in update()
+  const ulong_t n_spikes = B_.n_spikes_[V_.n_spikes_offset_ + prt];
   
   if ( n_spikes > 0 ) // we must not send events with multiplicity 0
   {
@@ -173,6 +173,13 @@ namespace nest{
        */
 
       std::vector<Age_distribution_> age_distributions_;
+
+      /**
+       * Spike counts for all targets at all lags of the current slice,
+       * drawn in update(). The count for port prt at lag is stored at
+       * (lag - from) * num_targets + prt.
+       */
+      std::vector<ulong_t> n_spikes_;
       
     };
 
@@ -195,6 +202,7 @@ namespace nest{
       //@{
       double_t t_min_active_;  //!< start of generator activity in slice 
       double_t t_max_active_;  //!< end of generator activity in slice 
+      size_t n_spikes_offset_; //!< index of counts for current lag in B_.n_spikes_
       //@}
     };
 
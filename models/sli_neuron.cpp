@@ -66,6 +66,11 @@ nest::sli_neuron::Buffers_::Buffers_(const Buffers_ &, sli_neuron &n)
 nest::sli_neuron::sli_neuron()
   : Archiving_Node(),
     state_(new Dictionary()),
+    in_spikes_t(0),
+    ex_spikes_t(0),
+    currents_t(0),
+    t_lag_t(0),
+    update_(),
     B_(*this)
 {
   // We add empty defaults for /calibrate and /update, so that the uninitialised node runs without errors.
@@ -77,6 +82,11 @@ nest::sli_neuron::sli_neuron()
 nest::sli_neuron::sli_neuron(const sli_neuron& n)
   : Archiving_Node(n),
     state_(new Dictionary(*n.state_)),
+    in_spikes_t(0),
+    ex_spikes_t(0),
+    currents_t(0),
+    t_lag_t(0),
+    update_(),
     B_(n.B_, *this)
 {
   init_state_(n);
@@ -133,12 +143,39 @@ void nest::sli_neuron::calibrate()
 #pragma omp critical (sli_neuron)
   {
     network()->execute_sli_protected(state_, names::calibrate_node);   // call interpreter
+
+    // compile /update once, after calibrate has defined its constants
+    update_ = network()->compile_sli_procedure(state_, names::update);
   }
 }
 
 /* ---------------------------------------------------------------- 
  * Update and spike handling functions
  */
+
+namespace
+{
+  // Assign a value to an entry of the status dictionary. If the entry
+  // already holds a datum of the right type, which nobody else refers
+  // to, the value is stored in place instead of allocating a new datum.
+  inline
+  void set_double_(Token &t, double v)
+  {
+    if ( !t.empty() && t->isoftype(SLIInterpreter::Doubletype) && t->numReferences() == 1 )
+      static_cast<DoubleDatum*>(t.datum())->get() = v;
+    else
+      t = new DoubleDatum(v);
+  }
+
+  inline
+  void set_long_(Token &t, long v)
+  {
+    if ( !t.empty() && t->isoftype(SLIInterpreter::Integertype) && t->numReferences() == 1 )
+      static_cast<IntegerDatum*>(t.datum())->get() = v;
+    else
+      t = new IntegerDatum(v);
+  }
+}
  
 void nest::sli_neuron::update(Time const & origin, const long_t from, const long_t to)
 {
@@ -155,32 +192,45 @@ void nest::sli_neuron::update(Time const & origin, const long_t from, const long
       return;
     }
 
-  for ( long_t lag = from ; lag < to ; ++lag )
-  {
-    (*state_)[names::in_spikes]=B_.in_spikes_.get_value(lag); // in spikes arriving at right border
-    (*state_)[names::ex_spikes]=B_.ex_spikes_.get_value(lag); // ex spikes arriving at right border
-    (*state_)[names::currents]=B_.currents_.get_value(lag);   
-    (*state_)[names::t_lag]=lag;
-    
-#pragma omp critical (sli_neuron)
-    {
-      network()->execute_sli_protected(state_, names::update_node);   // call interpreter
-    }
-
-    bool spike_emission= false;
-    if (state_->known(names::spike))
-      spike_emission=(*state_)[names::spike];
+  // Entries of the status dictionary keep their address, so we look
+  // them up once per time slice and then assign the inputs directly.
+  in_spikes_t = &(*state_)[names::in_spikes];
+  ex_spikes_t = &(*state_)[names::ex_spikes];
+  currents_t = &(*state_)[names::currents];
+  t_lag_t = &(*state_)[names::t_lag];
 
-    // threshold crossing
-    if (spike_emission)
+  // All nodes share the interpreter. We lock it once for the steps
+  // of the time slice, instead of once per step.
+#pragma omp critical (sli_neuron)
+  {
+    for ( long_t lag = from ; lag < to ; ++lag )
     {
-      set_spiketime(Time::step(origin.get_steps()+lag+1));
-      SpikeEvent se;
-      network()->send(*this, se, lag);
+      set_double_(*in_spikes_t, B_.in_spikes_.get_value(lag)); // in spikes arriving at right border
+      set_double_(*ex_spikes_t, B_.ex_spikes_.get_value(lag)); // ex spikes arriving at right border
+      set_double_(*currents_t, B_.currents_.get_value(lag));
+      set_long_(*t_lag_t, lag);
+
+      // call interpreter
+      if ( update_.empty() )
+        network()->execute_sli_protected(state_, names::update_node);
+      else
+        network()->execute_sli_protected(state_, names::execute_node, update_);
+
+      bool spike_emission= false;
+      if (state_->known(names::spike))
+        spike_emission=(*state_)[names::spike];
+
+      // threshold crossing
+      if (spike_emission)
+      {
+        set_spiketime(Time::step(origin.get_steps()+lag+1));
+        SpikeEvent se;
+        network()->send(*this, se, lag);
+      }
+
+      B_.logger_.record_data(origin.get_steps()+lag);
     }
-
-    B_.logger_.record_data(origin.get_steps()+lag);
-  }  
+  }
 }                           
                      
 
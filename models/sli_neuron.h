@@ -64,6 +64,11 @@ variables override names in the systemdict or in the userdict.
 Moreover, all definitions are done in the node's statusdict and
 persist throughout the simulation.
 
+After /calibrate, /update is compiled in the node's namespace (see
+compile). Names which are bound to functions at this time are bound
+for the whole simulation, all other names are looked up in each
+step. Changes of /update take effect at the next call of Simulate.
+
 Errors.
 If an error occurs during the evaluation of /calibrate or /update, the
 errorneous neuron is skipped and update proceeds to the next node
@@ -179,18 +184,20 @@ SeeAlso: iaf_psc_delta, iaf_psc_exp, iaf_cond_exp, testsuite::test_sli_neuron
      */   
     DictionaryDatum state_;
     /** 
-     * These are pointers into the status dictionary and must be updated in
-     * calibrate.
+     * These are pointers into the status dictionary and must be updated
+     * at the beginning of each call to update.
      */
-    Token *vm_t; //!< Points to V_m
-    Token *update_t; //!< points to update
-    Token *calibrate_t; //!< points to calibrate 
-    Token *in_spikes_t; //!< number of excitatory spikes during the time slice 
-    Token *ex_spikes_t; //!< number of inhibitory spikes during the sime slice
+    Token *in_spikes_t; //!< number of inhibitory spikes during the time step
+    Token *ex_spikes_t; //!< number of excitatory spikes during the time step
     Token *currents_t;  //!< external current
-    Token *last_spike_t; //!< time of last spike
-    Token *out_events_t; //!< Events produced by the neuron
-    Token *spike_t;//< Boolean for fast spike initiation
+    Token *t_lag_t;     //!< time step within the time slice
+
+    /**
+     * /update, compiled in calibrate. Empty if /update is not a
+     * procedure, in which case update_node is called instead.
+     */
+    Token update_;
+
     Buffers_        B_;
 
     //! Mapping of recordables names to access functions
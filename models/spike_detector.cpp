@@ -30,10 +30,15 @@
 #include "sibling_container.h"
 
 #include <numeric>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 nest::spike_detector::spike_detector()
         : Node(),
           device_(*this, RecordingDevice::SPIKE_DETECTOR, "gdf", true, true),  // record time and gid
+          chunk_size_(65536),
+          bin_width_(Time::ms(1.0)),
           user_set_precise_times_(false),
           has_proxies_(false),
           local_receiver_(true)
@@ -42,15 +47,20 @@ nest::spike_detector::spike_detector()
 nest::spike_detector::spike_detector(const spike_detector &n)
         : Node(n),
           device_(*this, n.device_),
+          chunk_size_(n.chunk_size_),
+          bin_width_(n.bin_width_),
           user_set_precise_times_(n.user_set_precise_times_),
           has_proxies_(false),
           local_receiver_(true)
-{}
+{
+  bin_width_.calibrate();
+}
 
 void nest::spike_detector::init_state_(const Node& np)
 {
   const spike_detector& sd = dynamic_cast<const spike_detector&>(np);
   device_.init_state(sd.device_);
+  S_.clear();
   init_buffers_();
 }
 
@@ -60,6 +70,10 @@ void nest::spike_detector::init_buffers_()
 
   std::vector<std::vector<Event*> > tmp(2, std::vector<Event*>());
   B_.spikes_.swap(tmp);
+
+  B_.chunk_gids_.clear();
+  B_.chunk_steps_.clear();
+  B_.chunk_offsets_.clear();
 }
 
 void nest::spike_detector::calibrate()
@@ -75,6 +89,13 @@ void nest::spike_detector::calibrate()
   }
 
   device_.calibrate();
+
+  // resolution may have changed since bin width was set
+  if ( device_.to_accumulator() && !bin_width_.is_step() )
+    throw StepMultipleRequired(get_name(), names::bin_width, bin_width_);
+
+  if ( to_binary_file_() )
+    write_binary_header_();
 }
 
 void nest::spike_detector::update(Time const&, const long_t, const long_t)
@@ -85,6 +106,21 @@ void nest::spike_detector::update(Time const&, const long_t, const long_t)
   {
     assert(*e != 0);
     device_.record_event(**e);
+
+    if ( device_.to_accumulator() )
+      accumulate_(**e);
+
+    if ( to_binary_file_() )
+    {
+      B_.chunk_gids_.push_back((*e)->get_sender_gid());
+      B_.chunk_steps_.push_back((*e)->get_stamp().get_steps());
+      if ( device_.precise_times() )
+        B_.chunk_offsets_.push_back((*e)->get_offset());
+
+      if ( B_.chunk_gids_.size() >= static_cast<size_t>(chunk_size_) )
+        write_binary_chunk_();
+    }
+
     delete *e;
   }
   
@@ -93,10 +129,92 @@ void nest::spike_detector::update(Time const&, const long_t, const long_t)
   B_.spikes_[network()->read_toggle()].clear();  
 } 
 
+void nest::spike_detector::accumulate_(const Event& e)
+{
+  const long_t step = e.get_stamp().get_steps();
+  double_t t = e.get_stamp().get_ms();
+  if ( device_.precise_times() )
+    t -= e.get_offset();
+
+  S_.senders_[e.get_sender_gid()].add_spike(t);
+
+  // spikes are recorded only if step > t_min, see RecordingDevice::is_active()
+  assert(step > device_.get_t_min_());
+  const size_t bin = (step - device_.get_t_min_() - 1) / bin_width_.get_steps();
+  if ( bin >= S_.histogram_.size() )
+    S_.histogram_.resize(bin + 1, 0);
+  ++S_.histogram_[bin];
+}
+
+nest::double_t nest::spike_detector::active_time_() const
+{
+  const long_t t_begin = std::max(device_.get_t_min_(), 0L);
+  const long_t t_end = std::min(device_.get_t_max_(), network()->get_time().get_steps());
+
+  return t_end > t_begin ? Time(Time::step(t_end - t_begin)).get_ms() : 0.0;
+}
+
+void nest::spike_detector::write_binary_header_()
+{
+  if ( !device_.file_is_empty() )
+    return;   // header has been written before
+
+  std::vector<char>& buf = B_.fbuf_;
+  buf.clear();
+
+  const char magic[8] = { 'N', 'E', 'S', 'T', 'S', 'D', 'F', 1 };
+  buf.insert(buf.end(), magic, magic + 8);
+  RecordingDevice::append_binary(buf, static_cast<unsigned int>(0x01020304));
+  RecordingDevice::append_binary(buf, static_cast<unsigned int>(sizeof(long_t)));
+  RecordingDevice::append_binary(buf, static_cast<unsigned int>(sizeof(double_t)));
+  RecordingDevice::append_binary(buf, Time::get_resolution().get_ms());
+
+  device_.write_to_file(&buf[0], buf.size());
+}
+
+void nest::spike_detector::write_binary_chunk_()
+{
+  const long_t n = B_.chunk_gids_.size();
+  if ( n == 0 )
+    return;
+
+  // offsets are either recorded for all spikes in the chunk or for none
+  const bool with_offsets = !B_.chunk_offsets_.empty();
+  assert(!with_offsets || B_.chunk_offsets_.size() == B_.chunk_gids_.size());
+
+  std::vector<char>& buf = B_.fbuf_;
+  buf.clear();
+
+  RecordingDevice::append_binary(buf, n);
+  RecordingDevice::append_binary(buf, static_cast<long_t>(with_offsets ? 1 : 0));
+  RecordingDevice::append_binary(buf, *std::min_element(B_.chunk_steps_.begin(), B_.chunk_steps_.end()));
+  RecordingDevice::append_binary(buf, *std::max_element(B_.chunk_steps_.begin(), B_.chunk_steps_.end()));
+  RecordingDevice::append_binary(buf, *std::min_element(B_.chunk_gids_.begin(), B_.chunk_gids_.end()));
+  RecordingDevice::append_binary(buf, *std::max_element(B_.chunk_gids_.begin(), B_.chunk_gids_.end()));
+  RecordingDevice::append_binary(buf, B_.chunk_gids_);
+  RecordingDevice::append_binary(buf, B_.chunk_steps_);
+  RecordingDevice::append_binary(buf, B_.chunk_offsets_);
+
+  device_.write_to_file(&buf[0], buf.size());
+
+  // clear() keeps the capacity for the next chunk
+  B_.chunk_gids_.clear();
+  B_.chunk_steps_.clear();
+  B_.chunk_offsets_.clear();
+}
+
 void nest::spike_detector::get_status(DictionaryDatum &d) const
 {
   // get the data from the device
   device_.get_status(d);
+  (*d)[names::chunk_size] = chunk_size_;
+  (*d)[names::bin_width] = bin_width_.get_ms();
+
+  if ( device_.to_accumulator() )
+  {
+    DictionaryDatum dict = getValue<DictionaryDatum>(d, names::events);
+    S_.get(dict, active_time_());
+  }
 
   // if we are the device on thread 0, also get the data from the
   // siblings on other threads
@@ -109,12 +227,136 @@ void nest::spike_detector::get_status(DictionaryDatum &d) const
   }
 }
 
+void nest::spike_detector::take_events(DictionaryDatum &d)
+{
+  device_.take_events(d);
+
+  if ( device_.to_accumulator() )
+  {
+    S_.get(d, active_time_());
+    S_.clear();
+  }
+
+  // if we are the device on thread 0, also take the data from the
+  // siblings on other threads
+  if (local_receiver_ && get_thread() == 0)
+  {
+    const SiblingContainer* siblings = network()->get_thread_siblings(get_gid());
+    std::vector<Node*>::const_iterator sibling;
+    for (sibling = siblings->begin() + 1; sibling != siblings->end(); ++sibling)
+      (*sibling)->take_events(d);
+  }
+}
+
 void nest::spike_detector::set_status(const DictionaryDatum &d)
 {
   if (d->known(names::precise_times))
     user_set_precise_times_ = true;
 
+  long_t chunk_size = chunk_size_;
+  if ( updateValue<long_t>(d, names::chunk_size, chunk_size) && chunk_size < 1 )
+    throw BadProperty("/chunk_size must be positive.");
+
+  Time bin_width = bin_width_;
+  double_t t;
+  if ( updateValue<double_t>(d, names::bin_width, t) )
+  {
+    bin_width = Time::ms(t);
+    if ( bin_width.get_steps() < 1 )
+      throw BadProperty("/bin_width must be positive.");
+    if ( !bin_width.is_step() )
+      throw StepMultipleRequired(get_name(), names::bin_width, bin_width);
+  }
+
   device_.set_status(d);
+  chunk_size_ = chunk_size;
+
+  // changing the bin width invalidates the histogram
+  if ( bin_width != bin_width_ )
+    S_.histogram_.clear();
+  bin_width_ = bin_width;
+
+  // device has cleared its data, see RecordingDevice::set_status()
+  long_t ne;
+  if ( updateValue<long_t>(d, names::n_events, ne) )
+    S_.clear();
+}
+
+nest::spike_detector::SenderStats_::SenderStats_()
+  : n_spikes_(0),
+    last_spike_(0.0),
+    n_isi_(0),
+    isi_mean_(0.0),
+    isi_m2_(0.0)
+{}
+
+void nest::spike_detector::SenderStats_::add_spike(double_t t)
+{
+  if ( n_spikes_ > 0 )
+  {
+    const double_t isi = t - last_spike_;
+    ++n_isi_;
+    const double_t delta = isi - isi_mean_;
+    isi_mean_ += delta / n_isi_;
+    isi_m2_ += delta * (isi - isi_mean_);
+  }
+  ++n_spikes_;
+  last_spike_ = t;
+}
+
+nest::double_t nest::spike_detector::SenderStats_::isi_cv() const
+{
+  if ( n_isi_ == 0 || isi_mean_ == 0.0 )
+    return std::numeric_limits<double_t>::quiet_NaN();
+
+  return std::sqrt(isi_m2_ / n_isi_) / isi_mean_;
+}
+
+void nest::spike_detector::State_::clear()
+{
+  senders_.clear();
+  histogram_.clear();
+}
+
+void nest::spike_detector::State_::get(DictionaryDatum& d, double_t active_time) const
+{
+  std::vector<long> senders;
+  std::vector<long> n_spikes;
+  std::vector<double_t> rates;
+  std::vector<double_t> isi_mean;
+  std::vector<double_t> isi_cv;
+
+  senders.reserve(senders_.size());
+  n_spikes.reserve(senders_.size());
+  rates.reserve(senders_.size());
+  isi_mean.reserve(senders_.size());
+  isi_cv.reserve(senders_.size());
+
+  for ( std::map<index, SenderStats_>::const_iterator it = senders_.begin(); 
+        it != senders_.end(); ++it )
+  {
+    const SenderStats_& st = it->second;
+    senders.push_back(it->first);
+    n_spikes.push_back(st.n_spikes_);
+    rates.push_back(active_time > 0 ? 1000.0 * st.n_spikes_ / active_time : 0.0);
+    isi_mean.push_back(st.n_isi_ > 0 ? st.isi_mean_ 
+                                     : std::numeric_limits<double_t>::quiet_NaN());
+    isi_cv.push_back(st.isi_cv());
+  }
+
+  initialize_property_intvector(d, names::senders);
+  append_property(d, names::senders, senders);
+  initialize_property_intvector(d, names::n_spikes);
+  append_property(d, names::n_spikes, n_spikes);
+  initialize_property_doublevector(d, names::rates);
+  append_property(d, names::rates, rates);
+  initialize_property_doublevector(d, names::isi_mean);
+  append_property(d, names::isi_mean, isi_mean);
+  initialize_property_doublevector(d, names::isi_cv);
+  append_property(d, names::isi_cv, isi_cv);
+
+  initialize_property_intvector(d, names::histogram);
+  accumulate_property(d, names::histogram, std::vector<long>(histogram_.begin(), histogram_.end()));
 }
 
 void nest::spike_detector::handle(SpikeEvent & e)
@@ -25,6 +25,7 @@
 
 
 #include <vector>
+#include <map>
 #include "nest.h"
 #include "event.h"
 #include "node.h"
@@ -59,6 +60,67 @@ desired to be recorded, are recorded.
 
 Spike are not necessarily written to file in chronological order.
 
+Binary output:
+If /to_file and /binary are set, spikes are written to file in a chunked, 
+columnar binary format instead of ASCII lines. Each chunk begins with a 
+small header giving the range of times and GIDs in the chunk, so that readers
+can skip chunks outside a time window or GID range without reading their data.
+Chunks are written when /chunk_size spikes have been collected and at the end
+of each call to Simulate. All values are written in the native byte order and
+sizes of the machine. The file consists of
+
+ file header:  char[8]       magic "NESTSDF" followed by format version (1)
+               unsigned int  0x01020304, to determine byte order
+               unsigned int  sizeof(long), sizeof(double)
+               double        simulation resolution in ms
+ chunks:       long          number of spikes n in chunk
+               long          flags; bit 0 set if the chunk contains offsets
+               long          smallest and largest time stamp in steps
+               long          smallest and largest sender GID
+               long[n]       sender GIDs
+               long[n]       time stamps in steps
+               double[n]     offsets in ms (only if flag bit 0 set), the
+                             precise spike time is step * resolution - offset
+
+All spikes are recorded with GID and time, irrespective of /withgid and
+/withtime. PyNEST provides nest.spike_file to read such files via memory
+mapping, selecting a time window and/or GIDs, and to merge the files
+written by different virtual processes into a single file in time order.
+
+Accumulator mode:
+Spike detector can operate in accumulator mode. In this case, spikes are not
+stored, but only statistics are collected as spikes arrive: the number of
+spikes from all senders in bins of width /bin_width, and for each sender the
+number of spikes, the time of its last spike, and mean and variance of its
+inter-spike intervals (ISIs). The statistics are kept separately on each 
+thread and are combined when the status of the detector is read. The events 
+dictionary then contains
+
+ /senders   - GIDs of all senders that have spiked
+ /n_spikes  - number of spikes of each sender
+ /rates     - firing rate of each sender in spikes/s, i.e., /n_spikes divided
+              by the time the detector has been active so far
+ /isi_mean  - mean ISI of each sender in ms (NaN for fewer than two spikes)
+ /isi_cv    - coefficient of variation of the ISIs of each sender
+              (NaN for fewer than two spikes)
+ /histogram - number of spikes from all senders in bins of width /bin_width,
+              bin i contains spikes with times in (t0 + i*w, t0 + (i+1)*w], 
+              where t0 = origin + start and w = /bin_width
+
+To activate accumulator mode, either set /to_accumulator to true, or set
+/record_to [ /accumulator ]. In accumulator mode, you cannot record to file,
+to memory, to screen, with GID or with weight. Setting /n_events to 0 clears
+all statistics. The histogram is relative to origin and start at the time
+each spike is recorded, so statistics should be cleared if these are changed.
+Rates reflect spikes recorded so far, which lag the simulation time by up to
+one min_delay.
+
+Parameters:
+/chunk_size - Number of spikes per chunk when writing binary files 
+              (default: 65536).
+/bin_width  - Width of histogram bins in accumulator mode, in ms; must be a
+              multiple of the resolution (default: 1.0).
+
 Receives: SpikeEvent
 
 SeeAlso: spike_detector, Device, RecordingDevice
@@ -120,6 +182,7 @@ namespace nest
 
     void get_status(DictionaryDatum &) const;
     void set_status(const DictionaryDatum &) ;
+    void take_events(DictionaryDatum &);
 
   private:
     void init_state_(Node const&);
@@ -138,6 +201,69 @@ namespace nest
      */
     void update(Time const &, const long_t, const long_t);
 
+    /**
+     * Return true if spikes are written to file in binary chunks.
+     */
+    bool to_binary_file_() const;
+
+    /**
+     * Write file header for binary output, if the file is new.
+     */
+    void write_binary_header_();
+
+    /**
+     * Write spikes collected in the chunk buffer to file.
+     */
+    void write_binary_chunk_();
+
+    /**
+     * Update statistics with a spike in accumulator mode.
+     */
+    void accumulate_(const Event&);
+
+    /**
+     * Return time in ms during which the detector has been active
+     * until now.
+     */
+    double_t active_time_() const;
+
+    // ------------------------------------------------------------
+
+    /**
+     * Running statistics of spikes from one sender in accumulator mode.
+     * ISI mean and variance are updated using Welford's algorithm.
+     */
+    struct SenderStats_ {
+      long_t   n_spikes_;     //!< number of spikes
+      double_t last_spike_;   //!< time of last spike in ms
+      long_t   n_isi_;        //!< number of ISIs
+      double_t isi_mean_;     //!< mean of ISIs in ms
+      double_t isi_m2_;       //!< sum of squared deviations of ISIs from mean
+
+      SenderStats_();
+
+      void add_spike(double_t);  //!< Update statistics with spike at given time
+      double_t isi_cv() const;   //!< Return CV of ISIs, NaN if undefined
+    };
+
+    /**
+     * Statistics collected in accumulator mode.
+     */
+    struct State_ {
+      std::map<index, SenderStats_> senders_;  //!< statistics per sender
+      std::vector<long_t> histogram_;          //!< spike count per bin, all senders
+
+      void clear();  //!< Clear all statistics
+
+      /**
+       * Add statistics to events dictionary. Statistics for other senders
+       * are appended, histograms are added.
+       */
+      void get(DictionaryDatum&, double_t active_time) const;
+    };
+
+    // ------------------------------------------------------------
+
     /**
      * Buffer for incoming spikes. 
      *
@@ -159,11 +285,21 @@ namespace nest
      */
     struct Buffers_ {
       std::vector<std::vector<Event*> > spikes_; 
+
+      //! Columns of the current chunk for binary output.
+      std::vector<long_t>   chunk_gids_;
+      std::vector<long_t>   chunk_steps_;
+      std::vector<double_t> chunk_offsets_;
+
+      std::vector<char>     fbuf_;   //!< chunk serialized for writing
     };
     
     RecordingDevice device_;
+    State_   S_;
     Buffers_ B_;
 
+    long_t chunk_size_;  //!< number of spikes per chunk in binary files
+    Time   bin_width_;   //!< width of histogram bins in accumulator mode
     bool user_set_precise_times_;
     bool has_proxies_ ;
     bool local_receiver_;
@@ -192,8 +328,17 @@ namespace nest
   inline
   void spike_detector::finalize()
   {
+    // make file readable after Simulate, and write before file may be closed
+    if ( to_binary_file_() )
+      write_binary_chunk_();
     device_.finalize();
   }
+
+  inline
+  bool spike_detector::to_binary_file_() const
+  {
+    return device_.to_file() && device_.binary();
+  }
     
 } // namespace
 
@@ -30,24 +30,26 @@
 #include "dictutils.h"
 #include "exceptions.h"
 
+#include <algorithm>
+
 
 /* ---------------------------------------------------------------- 
  * Default constructors defining default parameters and state
  * ---------------------------------------------------------------- */
 
 nest::spike_generator::Parameters_::Parameters_()
-  : spike_stamps_(),
-    spike_offsets_(),
-    spike_weights_(),
+  : store_(new SpikeStore_),
+    first_(0),
+    n_spikes_(0),
     precise_times_(false),
     allow_offgrid_spikes_(false),
     shift_now_spikes_(false)
 {}
 
 nest::spike_generator::Parameters_::Parameters_(const Parameters_& op)
-  : spike_stamps_(op.spike_stamps_),
-    spike_offsets_(op.spike_offsets_),
-    spike_weights_(op.spike_weights_),
+  : store_(op.store_),
+    first_(op.first_),
+    n_spikes_(op.n_spikes_),
     precise_times_(op.precise_times_),
     allow_offgrid_spikes_(op.allow_offgrid_spikes_),
     shift_now_spikes_(op.shift_now_spikes_)
@@ -64,85 +66,105 @@ nest::spike_generator::State_::State_()
 
 void nest::spike_generator::Parameters_::get(DictionaryDatum &d) const
 {  
-  const size_t n_spikes = spike_stamps_.size();
-  const size_t n_offsets = spike_offsets_.size();
-
-  assert(   ( precise_times_ && n_offsets == n_spikes )
-	 || (!precise_times_ && n_offsets == 0        ) );
+  assert(   !precise_times_ 
+	 || store_->offsets_.size() == store_->stamps_.size() );
 
-
-  std::vector<double_t>* times_ms = new std::vector<double_t>();
-  times_ms->reserve(n_spikes);
-  for ( size_t n = 0 ; n < n_spikes ; ++n )
+  std::vector<double_t>* times_ms = new std::vector<double_t>(n_spikes_);
+  for ( size_t n = 0 ; n < n_spikes_ ; ++n )
   {
-    times_ms->push_back(spike_stamps_[n].get_ms());
+    (*times_ms)[n] = stamp_(n).get_ms();
     if ( precise_times_ )
-      (*times_ms)[n] -= spike_offsets_[n];
+      (*times_ms)[n] -= offset_(n);
   }
+
+  std::vector<double_t>* weights = new std::vector<double_t>();
+  if ( has_weights_() )
+    weights->assign(store_->weights_.begin() + first_,
+                    store_->weights_.begin() + first_ + n_spikes_);
+
   (*d)[names::spike_times] = DoubleVectorDatum(times_ms);
-  (*d)["spike_weights"] = DoubleVectorDatum(new std::vector<double_t>(spike_weights_));
+  (*d)["spike_weights"] = DoubleVectorDatum(weights);
   (*d)[names::precise_times] = BoolDatum(precise_times_);
   (*d)["allow_offgrid_spikes"] = BoolDatum(allow_offgrid_spikes_);
   (*d)["shift_now_spikes"] = BoolDatum(shift_now_spikes_);
 
 }
  
-void nest::spike_generator::Parameters_::assert_valid_spike_time_and_insert_(double t,
-									     const Time& origin,
-									     const Time& now)
+void nest::spike_generator::Parameters_::append_spike_times_(SpikeStore_& store,
+                                                             const double* begin,
+                                                             const double* end,
+                                                             const Time& origin,
+                                                             const Time& now,
+                                                             bool with_offsets) const
 {
-  if (t == 0.0 && !shift_now_spikes_)
-    throw BadProperty("spike time cannot be set to 0.");
+  assert(!precise_times_ || with_offsets);
+  if ( begin == end )
+    return;
 
-  Time t_spike;
-  if ( precise_times_ )
-    t_spike = Time::ms_stamp(t);
-  else 
+  // check ordering first, so that the conversion below need not look back
+  for ( const double* t = begin + 1 ; t != end ; ++t )
+    if ( *(t - 1) > *t )
+      throw BadProperty("Spike times must be sorted in non-descending order.");
+
+  for ( const double* t = begin ; t != end ; ++t )
   {
-    // In this case, we need to force the spike time to the grid
+    if ( *t == 0.0 && !shift_now_spikes_ )
+      throw BadProperty("spike time cannot be set to 0.");
 
-    // First, convert the spike time to tics, may not be on grid
-    t_spike = Time::ms(t);
-    if ( not t_spike.is_grid_time() )
+    Time t_spike;
+    if ( precise_times_ )
+      t_spike = Time::ms_stamp(*t);
+    else 
     {
-      if ( allow_offgrid_spikes_ )
-      {
-	// In this case, we need to round to the end of the step
-	// in which t lies, ms_stamp does that for us.
-	t_spike = Time::ms_stamp(t);
-      }
-      else
+      // In this case, we need to force the spike time to the grid
+
+      // First, convert the spike time to tics, may not be on grid
+      t_spike = Time::ms(*t);
+      if ( not t_spike.is_grid_time() )
       {
-	std::stringstream msg;
-	msg << "spike_generator: Time point " << t 
-	    << " is not representable in current resolution.";
-	throw BadProperty(msg.str());
+	if ( allow_offgrid_spikes_ )
+	{
+	  // In this case, we need to round to the end of the step
+	  // in which t lies, ms_stamp does that for us.
+	  t_spike = Time::ms_stamp(*t);
+	}
+	else
+	{
+	  std::stringstream msg;
+	  msg << "spike_generator: Time point " << *t 
+	      << " is not representable in current resolution.";
+	  throw BadProperty(msg.str());
+	}
       }
-    }
 
-    assert(t_spike.is_grid_time());
+      assert(t_spike.is_grid_time());
 
-    if ( origin + t_spike == now && shift_now_spikes_ )
-      t_spike.advance();
-  }
-  // t_spike is now the correct time stamp given the chosen options
+      if ( origin + t_spike == now && shift_now_spikes_ )
+	t_spike.advance();
+    }
+    // t_spike is now the correct time stamp given the chosen options
 
-  // when we get here, we know that the spike time is valid
-  spike_stamps_.push_back(t_spike);
-  if ( precise_times_ )
-  {
-    // t_spike is created with ms_stamp() that alignes
-    // the time to the next resolution step, so the offset
-    // has to be greater or equal to t by construction.
-    // Since substraction of closeby floating point values is 
-    // not stable, we have to compare with a delta.
-    double_t offset = t_spike.get_ms() - t;
-    if (std::fabs(offset) < std::numeric_limits<double>::epsilon())
-    { // if difference is smaller than epsilon 
-      offset = 0.0;  // than it is actually 0.0
+    // when we get here, we know that the spike time is valid
+    store.stamps_.push_back(t_spike);
+    if ( with_offsets )
+    {
+      double_t offset = 0.0;
+      if ( precise_times_ )
+      {
+	// t_spike is created with ms_stamp() that alignes
+	// the time to the next resolution step, so the offset
+	// has to be greater or equal to t by construction.
+	// Since substraction of closeby floating point values is 
+	// not stable, we have to compare with a delta.
+	offset = t_spike.get_ms() - *t;
+	if (std::fabs(offset) < std::numeric_limits<double>::epsilon())
+	{ // if difference is smaller than epsilon 
+	  offset = 0.0;  // than it is actually 0.0
+	}
+	assert(offset >= 0.0);
+      }
+      store.offsets_.push_back(offset);
     }
-    assert(offset >= 0.0);
-    spike_offsets_.push_back(offset);
   }
 }
 
@@ -157,54 +179,62 @@ void nest::spike_generator::Parameters_::set(const DictionaryDatum& d, State_& s
 		      "or shift_now_spikes is set to true.");
 
   const bool updated_spike_times = d->known(names::spike_times);  
-  if ( flags_changed && !(updated_spike_times || spike_stamps_.empty()) )
+  if ( flags_changed && !(updated_spike_times || n_spikes_ == 0) )
     throw BadProperty("Options can only be set together with spike times or if no "
 		      "spike times have been set.");
 
-  if ( updated_spike_times )
-  {
-    const std::vector<double_t> d_times = getValue<std::vector<double> >(d->lookup(names::spike_times));
-    const size_t n_spikes = d_times.size();
-    spike_stamps_.clear();
-    spike_stamps_.reserve(n_spikes);
-    spike_offsets_.clear();
-    if ( precise_times_ )
-      spike_offsets_.reserve(n_spikes);
-
-    // Check spike times for ordering and grid compatibility and insert them
-    if ( !d_times.empty() )
-    { 
-      // handle first spike time, no predecessor to compare with
-      std::vector<double_t>::const_iterator prev = d_times.begin();
-      assert_valid_spike_time_and_insert_(*prev, origin, now);
-
-      // handle all remaining spike times, compare to predecessor
-      for ( std::vector<double_t>::const_iterator next = prev + 1;
-            next != d_times.end() ; ++next, ++prev )
-	if ( *prev > *next )
-	  throw BadProperty("Spike times must be sorted in non-descending order.");
-        else
-	  assert_valid_spike_time_and_insert_(*next, origin, now);
-    }
-  }
-
   // spike_weights can be the same size as spike_times, or can be of size 0 to
   // only use the spike_times array
-  bool updated_spike_weights = d->known("spike_weights");
-  if (updated_spike_weights)
+  const bool updated_spike_weights = d->known("spike_weights");
+
+  if ( updated_spike_times || updated_spike_weights )
   {
-    std::vector<double> spike_weights = getValue<std::vector<double> >(d->lookup("spike_weights"));
-    
-    if (spike_weights.empty())
-      spike_weights_.clear();
+    // the present store may be shared with other generators, so we
+    // never modify it, but fill a new one
+    lockPTR<SpikeStore_> store(new SpikeStore_);
+
+    if ( updated_spike_times )
+    {
+      const std::vector<double_t> d_times = getValue<std::vector<double> >(d->lookup(names::spike_times));
+      store->stamps_.reserve(d_times.size());
+      if ( precise_times_ )
+        store->offsets_.reserve(d_times.size());
+      if ( !d_times.empty() )
+        append_spike_times_(*store, &d_times[0], &d_times[0] + d_times.size(),
+                            origin, now, precise_times_);
+    }
     else
     {
-      if (spike_weights.size() != spike_stamps_.size())
-        throw BadProperty("spike_weights must have the same number of elements as spike_times,"
-                          " or 0 elements to clear the property.");
+      store->stamps_.assign(store_->stamps_.begin() + first_,
+                            store_->stamps_.begin() + first_ + n_spikes_);
+      if ( precise_times_ )
+        store->offsets_.assign(store_->offsets_.begin() + first_,
+                               store_->offsets_.begin() + first_ + n_spikes_);
+    }
 
-      spike_weights_.swap(spike_weights);
+    if ( updated_spike_weights )
+    {
+      std::vector<double> spike_weights = getValue<std::vector<double> >(d->lookup("spike_weights"));
+      if ( !spike_weights.empty() )
+      {
+        if ( spike_weights.size() != store->stamps_.size() )
+          throw BadProperty("spike_weights must have the same number of elements as spike_times,"
+                            " or 0 elements to clear the property.");
+        store->weights_.swap(spike_weights);
+      }
     }
+    else if ( has_weights_() )
+    {
+      if ( store->stamps_.size() != n_spikes_ )
+        throw BadProperty("spike_weights must be set together with spike_times if the number "
+                          "of spike times changes.");
+      store->weights_.assign(store_->weights_.begin() + first_,
+                             store_->weights_.begin() + first_ + n_spikes_);
+    }
+
+    store_ = store;
+    first_ = 0;
+    n_spikes_ = store_->stamps_.size();
   }
 
   // Set position to start if something changed
@@ -261,22 +291,22 @@ void nest::spike_generator::calibrate()
 
 void nest::spike_generator::update(Time const & sliceT0, const long_t from, const long_t to)
 {
-  if ( P_.spike_stamps_.empty() )
+  if ( P_.n_spikes_ == 0 )
     return;
 
   assert(    !P_.precise_times_ 
-          || P_.spike_stamps_.size() == P_.spike_offsets_.size() );
-  assert(    P_.spike_weights_.empty() 
-          || P_.spike_stamps_.size() == P_.spike_weights_.size() );
+          || P_.store_->stamps_.size() == P_.store_->offsets_.size() );
+  assert(    !P_.has_weights_()
+          || P_.store_->stamps_.size() == P_.store_->weights_.size() );
 
   const Time  tstart = sliceT0 + Time::step(from);
   const Time  tstop  = sliceT0 + Time::step(to);
   const Time& origin = device_.get_origin();
   
   // We fire all spikes with time stamps up to including sliceT0 + to
-  while ( S_.position_ < P_.spike_stamps_.size() )
+  while ( S_.position_ < P_.n_spikes_ )
   {
-    const Time tnext_stamp = origin + P_.spike_stamps_[S_.position_];
+    const Time tnext_stamp = origin + P_.stamp_(S_.position_);
 
     // this might happen due to wrong usage of the generator
     if ( tnext_stamp <= tstart ) 
@@ -290,25 +320,21 @@ void nest::spike_generator::update(Time const & sliceT0, const long_t from, cons
 
     if ( device_.is_active(tnext_stamp) )
     {
-      SpikeEvent* se;
-
       // if we have to deliver weighted spikes, we need to get the
       // event back to set its weight according to the entry in
       // spike_weights_, so we use a DSSpike event and event_hook()
-      if ( !P_.spike_weights_.empty() )
-        se = new DSSpikeEvent;
-      else
-	se = new SpikeEvent;
+      DSSpikeEvent dse;
+      SpikeEvent plain_se;
+      SpikeEvent& se = P_.has_weights_() ? dse : plain_se;
 
       if ( P_.precise_times_ )
-	se->set_offset(P_.spike_offsets_[S_.position_]);
+	se.set_offset(P_.offset_(S_.position_));
       
       // we need to subtract one from stamp which is added again in send()
       long_t lag = Time(tnext_stamp - sliceT0).get_steps() - 1;
       
       // all spikes are sent locally, so offset information is always preserved
-      network()->send(*this, *se, lag);
-      delete se;
+      network()->send(*this, se, lag);
     }
 
     ++S_.position_;
@@ -317,6 +343,109 @@ void nest::spike_generator::update(Time const & sliceT0, const long_t from, cons
 
 void nest::spike_generator::event_hook(DSSpikeEvent& e)
 {
-  e.set_weight(P_.spike_weights_[S_.position_] * e.get_weight());
+  e.set_weight(P_.weight_(S_.position_) * e.get_weight());
   e.get_receiver().handle(e);
 }
+
+
+/* ---------------------------------------------------------------- 
+ * Bulk loading of spike trains
+ * ---------------------------------------------------------------- */
+
+namespace
+{
+  // orders spike indices by generator GID
+  class GidLess_
+  {
+    const std::vector<long>& gids_;
+  public:
+    GidLess_(const std::vector<long>& gids) : gids_(gids) {}
+    bool operator()(size_t a, size_t b) const { return gids_[a] < gids_[b]; }
+  };
+}
+
+void nest::spike_generator::set_spike_trains(const std::vector<long>& gids,
+                                             const std::vector<double>& times)
+{
+  if ( gids.size() != times.size() )
+    throw BadProperty("SetSpikeTrains: GID and spike time arrays must have the same length.");
+
+  Network& net = *network();
+  const size_t n = gids.size();
+
+  // Bring spikes into generator order, preserving the order of the spikes
+  // of each generator. Usually, spikes are grouped by generator already.
+  const double* t = n > 0 ? &times[0] : 0;
+  std::vector<size_t> order;
+  std::vector<double> sorted_times;
+  bool sorted = true;
+  for ( size_t i = 1 ; i < n && sorted ; ++i )
+    sorted = gids[i - 1] <= gids[i];
+  if ( !sorted )
+  {
+    order.resize(n);
+    for ( size_t i = 0 ; i < n ; ++i )
+      order[i] = i;
+    std::stable_sort(order.begin(), order.end(), GidLess_(gids));
+
+    sorted_times.resize(n);
+    for ( size_t i = 0 ; i < n ; ++i )
+      sorted_times[i] = times[order[i]];
+    t = &sorted_times[0];
+  }
+
+  // Find the generator and the range of spikes for each GID.
+  std::vector<spike_generator*> generators;
+  std::vector<size_t> bounds(1, 0);
+  bool with_offsets = false;
+  while ( bounds.back() < n )
+  {
+    const size_t b = bounds.back();
+    const long gid = sorted ? gids[b] : gids[order[b]];
+    size_t e = b + 1;
+    while ( e < n && ( sorted ? gids[e] : gids[order[e]] ) == gid )
+      ++e;
+
+    spike_generator* sg = 0;
+    if ( gid > 0 && net.is_local_gid(gid) )
+      sg = dynamic_cast<spike_generator*>(net.get_node(gid, 0));
+    if ( sg == 0 )
+    {
+      std::stringstream msg;
+      msg << "SetSpikeTrains: Node " << gid << " is not a spike_generator.";
+      throw BadProperty(msg.str());
+    }
+
+    with_offsets = with_offsets || sg->P_.precise_times_;
+    generators.push_back(sg);
+    bounds.push_back(e);
+  }
+
+  // Convert all spike trains into a single store. Generators are only
+  // changed once all spike times have been found valid.
+  lockPTR<SpikeStore_> store(new SpikeStore_);
+  store->stamps_.reserve(n);
+  if ( with_offsets )
+    store->offsets_.reserve(n);
+
+  const Time now = net.get_time();
+  for ( size_t g = 0 ; g < generators.size() ; ++g )
+  {
+    const spike_generator& sg = *generators[g];
+    sg.P_.append_spike_times_(*store, t + bounds[g], t + bounds[g + 1],
+                              sg.device_.get_origin(), now, with_offsets);
+  }
+
+  for ( size_t g = 0 ; g < generators.size() ; ++g )
+  {
+    const index gid = generators[g]->get_gid();
+    for ( thread thr = 0 ; thr < net.get_num_threads() ; ++thr )
+    {
+      spike_generator& sg = static_cast<spike_generator&>(*net.get_node(gid, thr));
+      sg.P_.store_ = store;
+      sg.P_.first_ = bounds[g];
+      sg.P_.n_spikes_ = bounds[g + 1] - bounds[g];
+      sg.S_.position_ = 0;
+    }
+  }
+}
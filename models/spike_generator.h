@@ -33,6 +33,7 @@
 #include "connection.h"
 #include "nest_time.h"
 #include "network.h"
+#include "lockptr.h"
 
 namespace nest
 {
@@ -144,6 +145,22 @@ namespace nest
     Instructs the spike generator to generate events at 1.0, 2.0, and
     3.0 milliseconds, and use the weight of the connection.
 
+    Loading many spike trains:
+    For replay experiments with many generators, the spike trains of all
+    generators can be set in a single call with SetSpikeTrains, which
+    takes one array of generator GIDs and one array of spike times of
+    equal length, one entry per spike. Each generator converts its
+    spike times according to its own options. The spike data of all
+    generators set in one call are kept in a single block of memory,
+    which is shared by all threads instead of being copied to every
+    thread. Spike weights are cleared for all generators set this way.
+
+    Example:
+    /sg /spike_generator 2 Create def
+    [1 2 1] [1.0 2.0 3.0] SetSpikeTrains
+
+    Makes generator 1 spike at 1.0 and 3.0 ms and generator 2 at 2.0 ms.
+
     Parameters:
     The following properties can be set in the status dictionary.
 
@@ -160,7 +177,7 @@ namespace nest
          
     Author: Gewaltig, Diesmann, Eppler
 
-    SeeAlso: Device, StimulatingDevice, testsuite::test_spike_generator
+    SeeAlso: Device, StimulatingDevice, SetSpikeTrains, testsuite::test_spike_generator
   */
   
   /**
@@ -190,6 +207,21 @@ namespace nest
     using Node::event_hook;
     void event_hook(DSSpikeEvent&);
 
+    /**
+     * Set the spike trains of many spike generators at once.
+     *
+     * The generator with GID gids[i] emits a spike at times[i]; spike
+     * times must be sorted for each generator. The spike data of all
+     * generators is stored in one block shared by all generators and
+     * threads. Spike weights are cleared. No generator is changed if
+     * an error occurs.
+     *
+     * @throws BadProperty if a GID does not belong to a spike_generator
+     *         or a spike time is invalid
+     */
+    static void set_spike_trains(const std::vector<long>& gids,
+                                 const std::vector<double>& times);
+
   private:
     
     void init_state_(const Node&);
@@ -208,12 +240,27 @@ namespace nest
 
     // ------------------------------------------------------------
 
-    struct Parameters_ {
+    /**
+     * Spike data of one or more generators.
+     *
+     * A store is never modified once it has been filled, so that it can
+     * be shared by the thread siblings of a generator and by all
+     * generators set by set_spike_trains(). Setting spike times or
+     * weights creates a new store.
+     */
+    struct SpikeStore_ {
+      std::vector<Time> stamps_;    //!< Spike time stamp as Time, rel to origin_
+      std::vector<double> offsets_; //!< Spike time offsets, empty if no generator uses precise_times_
+      std::vector<double> weights_; //!< Spike weights, empty if not used
+    };
 
-      std::vector<Time> spike_stamps_;    //!< Spike time stamp as Time, rel to origin_
-      std::vector<double> spike_offsets_; //!< Spike time offset, if using precise_times_
+    // ------------------------------------------------------------
 
-      std::vector<double> spike_weights_;  //!< Spike weights as double
+    struct Parameters_ {
+
+      lockPTR<SpikeStore_> store_;  //!< Spike data, possibly shared
+      size_t first_;                //!< Index of first spike of this generator in store_
+      size_t n_spikes_;             //!< Number of spikes of this generator
 
       //! Interpret spike times as precise, i.e. send as step and offset
       bool precise_times_;           
@@ -238,13 +285,23 @@ namespace nest
       void set(const DictionaryDatum&, State_&, const Time&, const Time&);  
 
       /**
-       * Insert spike time to arrays, throw BadProperty for invalid spike times.
+       * Check that spike times are sorted and valid, convert them and
+       * append them to the store. Throws BadProperty for invalid spike times.
        *
-       * @param spike time, ms
+       * @param store to append to
+       * @param begin, end of spike times, ms
        * @param origin
        * @param current simulation time
+       * @param append offsets, zero unless precise_times_; must be true
+       *        if precise_times_
        */
-      void assert_valid_spike_time_and_insert_(double, const Time&, const Time&);
+      void append_spike_times_(SpikeStore_&, const double*, const double*,
+                               const Time&, const Time&, bool) const;
+
+      const Time& stamp_(size_t i) const { return store_->stamps_[first_ + i]; }
+      double offset_(size_t i) const { return store_->offsets_[first_ + i]; }
+      double weight_(size_t i) const { return store_->weights_[first_ + i]; }
+      bool has_weights_() const { return !store_->weights_.empty(); }
     };
         
     // ------------------------------------------------------------
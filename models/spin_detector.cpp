@@ -109,6 +109,21 @@ void nest::spin_detector::get_status(DictionaryDatum &d) const
   }
 }
 
+void nest::spin_detector::take_events(DictionaryDatum &d)
+{
+  device_.take_events(d);
+
+  // if we are the device on thread 0, also take the data from the
+  // siblings on other threads
+  if (get_thread() == 0)
+  {
+    const SiblingContainer* siblings = network()->get_thread_siblings(get_gid());
+    std::vector<Node*>::const_iterator sibling;
+    for (sibling = siblings->begin() + 1; sibling != siblings->end(); ++sibling)
+      (*sibling)->take_events(d);
+  }
+}
+
 void nest::spin_detector::set_status(const DictionaryDatum &d)
 {
   if (d->known(names::precise_times))
@@ -117,6 +117,7 @@ namespace nest
 
     void get_status(DictionaryDatum &) const;
     void set_status(const DictionaryDatum &) ;
+    void take_events(DictionaryDatum &);
 
   private:
 
@@ -36,6 +36,12 @@
 
 #ifndef _IS_PYNEST
 #include "gnureadline.h"
+#else
+#include <sstream>
+#include <stdexcept>
+#include "dictutils.h"
+#include "exceptions.h"
+#include "gid_collection.h"
 #endif
 
 #include "slistartup.h"
@@ -148,6 +154,137 @@ void nestshutdown(void)
 #endif
 }
 
+#ifdef _IS_PYNEST
+namespace
+{
+  /**
+   * Rethrow the exception being handled as std::runtime_error, with
+   * the message runprotected gives for errors raised in SLI. Must be
+   * called from a catch block.
+   */
+  void rethrow_for_pynest_(const char cmd[])
+  {
+    try
+    {
+      throw;
+    }
+    catch(SLIException &e)
+    {
+      throw std::runtime_error(std::string(e.what()) + " in " + cmd + ": " + e.message());
+    }
+    catch(std::exception &e)
+    {
+      throw std::runtime_error(std::string("C++Exception in ") + cmd + ": " + e.what());
+    }
+  }
+
+  /**
+   * Add the entries of the given Connect option, which spec does not
+   * contain, like :Connect_complete_dict in nest-init.sli.
+   */
+  void complete_connect_spec_(SLIInterpreter &engine, DictionaryDatum &spec, const Name &option)
+  {
+    DictionaryDatum options = getValue<DictionaryDatum>(engine.baselookup(Name("OptionsDictionary")));
+    DictionaryDatum connect = getValue<DictionaryDatum>(options, Name("Connect"));
+    DictionaryDatum defaults = getValue<DictionaryDatum>(connect, option);
+
+    for(Dictionary::const_iterator it = defaults->begin(); it != defaults->end(); ++it)
+      if(!spec->known(it->first))
+        spec->insert(it->first, it->second);
+  }
+}
+
+long pynest_create(nest::Network &net, const std::string &model, long n)
+{
+  try
+  {
+    if(n <= 0)
+      throw RangeCheck();
+
+    const Token t = net.get_modeldict().lookup(model);
+    if(t.empty())
+      throw nest::UnknownModelName(model);
+
+    return net.add_node(static_cast<nest::index>(t), n);
+  }
+  catch(...)
+  {
+    rethrow_for_pynest_("Create_l_i");
+  }
+  return 0;
+}
+
+void pynest_simulate(SLIInterpreter &engine, nest::Network &net, double t)
+{
+  try
+  {
+    std::ostringstream os;
+    os << "Simulating " << t << " ms.";
+    engine.message(SLIInterpreter::M_INFO, "Simulate", os.str().c_str());
+
+    net.simulate(nest::Time::ms(t));
+  }
+  catch(...)
+  {
+    rethrow_for_pynest_("Simulate_d");
+  }
+}
+
+void pynest_run(nest::Network &net, double t)
+{
+  try
+  {
+    net.run(nest::Time::ms(t));
+  }
+  catch(...)
+  {
+    rethrow_for_pynest_("Run_d");
+  }
+}
+
+void pynest_set_status(nest::Network &net, long gid, const DictionaryDatum &d)
+{
+  try
+  {
+    net.set_status(gid, d);
+  }
+  catch(...)
+  {
+    rethrow_for_pynest_("SetStatus_id");
+  }
+}
+
+DictionaryDatum* pynest_get_status(nest::Network &net, long gid)
+{
+  try
+  {
+    return new DictionaryDatum(net.get_status(gid));
+  }
+  catch(...)
+  {
+    rethrow_for_pynest_("GetStatus_i");
+  }
+  return 0;
+}
+
+void pynest_connect(SLIInterpreter &engine, nest::Network &net,
+                    const IntVectorDatum &sources, const IntVectorDatum &targets,
+                    DictionaryDatum &conn_spec, DictionaryDatum &syn_spec)
+{
+  try
+  {
+    complete_connect_spec_(engine, conn_spec, Name("conn_spec"));
+    complete_connect_spec_(engine, syn_spec, Name("syn_spec"));
+
+    net.connect(nest::GIDCollection(sources), nest::GIDCollection(targets), conn_spec, syn_spec);
+  }
+  catch(...)
+  {
+    rethrow_for_pynest_("Connect_g_g_D_D");
+  }
+}
+#endif
+
 #if defined(HAVE_LIBNEUROSIM) && defined(_IS_PYNEST)
 Datum* CYTHON_unpackConnectionGeneratorDatum(PyObject* obj)
 {
@@ -33,9 +33,14 @@
 #define CYTHON_isConnectionGenerator(x) PNS::isConnectionGenerator(x)
 Datum* CYTHON_unpackConnectionGeneratorDatum(PyObject*);
 
+// Connection generators written in Python are called by the
+// interpreter, so PyNEST must hold the GIL while SLI code runs
+#define CYTHON_RUN_NEEDS_GIL 1
+
 #else
 #define CYTHON_isConnectionGenerator(x) 0
 #define CYTHON_unpackConnectionGeneratorDatum(x) NULL
+#define CYTHON_RUN_NEEDS_GIL 0
 #endif
 
 namespace nest {
@@ -50,8 +55,27 @@ class SLIInterpreter;
 #define CYTHON_ADDR(x) (&x)
 
 #include <string>
+#include "dictdatum.h"
+#include "arraydatum.h"
+
 int neststartup(int argc, char** argv, SLIInterpreter &engine, nest::Network* &pNet, std::string modulepath = "");
 
+/*
+ * Direct entry points for the frequent calls of PyNEST. Each function
+ * does the same as the SLI command named in its comment, but takes
+ * its arguments from PyNEST directly instead of from the operand
+ * stack. Errors are thrown as std::runtime_error, whose message is the
+ * one PyNEST shows for the same error raised in SLI.
+ */
+long pynest_create(nest::Network &, const std::string &model, long n); // Create_l_i
+void pynest_simulate(SLIInterpreter &, nest::Network &, double t); // Simulate_d
+void pynest_run(nest::Network &, double t); // Run_d
+void pynest_set_status(nest::Network &, long gid, const DictionaryDatum &); // SetStatus_id
+DictionaryDatum* pynest_get_status(nest::Network &, long gid); // GetStatus_i
+void pynest_connect(SLIInterpreter &, nest::Network &,
+                    const IntVectorDatum &sources, const IntVectorDatum &targets,
+                    DictionaryDatum &conn_spec, DictionaryDatum &syn_spec); // Connect
+
 #else
 int neststartup(int argc, char** argv, SLIInterpreter &engine, nest::Network* &pNet);
 #endif
@@ -32,10 +32,15 @@
 
 #include "gsl_binomial_randomdev.h"
 #include "binomial_randomdev.h"
+#include "philox.h"
 #include "normal_randomdev.h"
 #include "gslrandomgen.h"
 #include "fdstream.h"
+#include "numerics.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <set>
 #ifdef _OPENMP
 #include <omp.h>
@@ -100,17 +105,17 @@ nest::ConnBuilder::ConnBuilder(Network& net,
   if ( !default_weight_and_delay_ )
   {
     weight_ = syn_spec->known(names::weight)
-              ? ConnParameter::create((*syn_spec)[names::weight])
-              : ConnParameter::create((*syn_defaults)[names::weight]);
+              ? ConnParameter::create((*syn_spec)[names::weight], net_.get_num_threads())
+              : ConnParameter::create((*syn_defaults)[names::weight], net_.get_num_threads());
     delay_ = syn_spec->known(names::delay)
-              ? ConnParameter::create((*syn_spec)[names::delay])
-              : ConnParameter::create((*syn_defaults)[names::delay]);
+              ? ConnParameter::create((*syn_spec)[names::delay], net_.get_num_threads())
+              : ConnParameter::create((*syn_defaults)[names::delay], net_.get_num_threads());
   }
   else if (!default_weight_)
   {
     delay_ = syn_spec->known(names::delay)
-              ? ConnParameter::create((*syn_spec)[names::delay])
-              : ConnParameter::create((*syn_defaults)[names::delay]);
+              ? ConnParameter::create((*syn_spec)[names::delay], net_.get_num_threads())
+              : ConnParameter::create((*syn_defaults)[names::delay], net_.get_num_threads());
   }
 
   // synapse-specific parameters
@@ -138,7 +143,7 @@ nest::ConnBuilder::ConnBuilder(Network& net,
       continue;  // weight, delay or not-settable parameter
 
     if ( syn_spec->known(param_name) )
-      synapse_params_[param_name] = ConnParameter::create((*syn_spec)[param_name]);
+      synapse_params_[param_name] = ConnParameter::create((*syn_spec)[param_name], net_.get_num_threads());
   }
 
   // Now create dictionary with dummy values that we will use
@@ -257,6 +262,19 @@ void nest::ConnBuilder::connect()
       throw WrappedThreadException(*(exceptions_raised_.at(thr)));
 }
 
+inline
+void nest::ConnBuilder::reserve_(thread t, size_t n)
+{
+  if ( weight_ != 0 )
+    weight_->reserve(t, n);
+  if ( delay_ != 0 )
+    delay_->reserve(t, n);
+  for ( ConnParameterMap::const_iterator it = synapse_params_.begin() ;
+	it != synapse_params_.end(); 
+	++it )
+    it->second->reserve(t, n);
+}
+
 inline
 void nest::ConnBuilder::single_connect_(index sgid,
 					Node& target, thread target_thread, librandom::RngPtr& rng)
@@ -268,11 +286,11 @@ void nest::ConnBuilder::single_connect_(index sgid,
       net_.connect(sgid, &target, target_thread, synapse_model_);
     else if (default_weight_)
       net_.connect(sgid, &target, target_thread, synapse_model_,
-		   delay_->value_double(sgid, tgid, rng));
+		   delay_->value_double(target_thread, sgid, tgid, rng));
     else
     {
-      double delay = delay_->value_double(sgid, tgid, rng);
-      double weight = weight_->value_double(sgid, tgid, rng);
+      double delay = delay_->value_double(target_thread, sgid, tgid, rng);
+      double weight = weight_->value_double(target_thread, sgid, tgid, rng);
       net_.connect(sgid, &target, target_thread, synapse_model_,
 		   delay, weight);
     }
@@ -291,7 +309,7 @@ void nest::ConnBuilder::single_connect_(index sgid,
 	{
 	  // change value of dictionary entry without allocating new datum
 	  IntegerDatum *id = static_cast<IntegerDatum *>(((*param_dicts_[target_thread])[it->first]).datum());
-	  (*id) = it->second->value_int(sgid, tgid, rng);
+	  (*id) = it->second->value_int(target_thread, sgid, tgid, rng);
         }
         catch(KernelException& e)
 	{
@@ -302,7 +320,7 @@ void nest::ConnBuilder::single_connect_(index sgid,
       {
 	// change value of dictionary entry without allocating new datum
 	DoubleDatum *dd = static_cast<DoubleDatum *>(((*param_dicts_[target_thread])[it->first]).datum());
-        (*dd) = it->second->value_double(sgid, tgid, rng);
+        (*dd) = it->second->value_double(target_thread, sgid, tgid, rng);
       }  
     }
 
@@ -312,11 +330,11 @@ void nest::ConnBuilder::single_connect_(index sgid,
     else if ( default_weight_ )
       net_.connect(sgid, &target, target_thread, synapse_model_, 
 		   param_dicts_[target_thread],
-		   delay_->value_double(sgid, tgid, rng));
+		   delay_->value_double(target_thread, sgid, tgid, rng));
     else
     {
-      double delay = delay_->value_double(sgid, tgid, rng);
-      double weight = weight_->value_double(sgid, tgid, rng);
+      double delay = delay_->value_double(target_thread, sgid, tgid, rng);
+      double weight = weight_->value_double(target_thread, sgid, tgid, rng);
       net_.connect(sgid, &target, target_thread, synapse_model_,
 		   param_dicts_[target_thread], delay, weight);
     }
@@ -343,6 +361,10 @@ void nest::OneToOneBuilder::connect_()
       // allocate pointer to thread specific random generator
       librandom::RngPtr rng = net_.get_rng(tid);
 
+      // collect the connections of this thread first, so that their
+      // number can be announced to the parameters
+      std::vector<std::pair<index, Node*> > conns;
+
       for ( GIDCollection::const_iterator tgid = targets_.begin(), sgid = sources_.begin();
             tgid != targets_.end();
             ++tgid, ++sgid )
@@ -363,8 +385,13 @@ void nest::OneToOneBuilder::connect_()
         if( tid != target_thread)
           continue;
 
-        single_connect_(*sgid, *target, target_thread, rng);
+        conns.push_back(std::make_pair(*sgid, target));
       }
+
+      reserve_(tid, conns.size());
+      for ( std::vector<std::pair<index, Node*> >::const_iterator c = conns.begin();
+            c != conns.end(); ++c )
+        single_connect_(c->first, *c->second, tid, rng);
     }
     catch ( std::exception& err )
     {
@@ -405,6 +432,11 @@ void nest::AllToAllBuilder::connect_()
         if( tid != target_thread)
           continue;
 
+        // without autapses, the target may be among the sources, so
+        // one connection less is a safe lower bound
+        reserve_(tid, autapses_ ? sources_.size()
+                                : std::max<size_t>(sources_.size(), 1) - 1);
+
         for ( GIDCollection::const_iterator 
  	      sgid = sources_.begin();
 	      sgid != sources_.end();
@@ -426,6 +458,57 @@ void nest::AllToAllBuilder::connect_()
   }
 }
 
+nest::PositionSampler::PositionSampler(size_t n)
+  : perm_(n),
+    swaps_()
+{
+  for ( size_t i = 0 ; i < n ; ++i )
+    perm_[i] = i;
+}
+
+void nest::PositionSampler::draw(librandom::RngPtr& rng, size_t k,
+                                 const GIDCollection& pool, index excluded,
+                                 std::vector<index>& drawn)
+{
+  assert(perm_.size() == pool.size());
+
+  drawn.clear();
+  swaps_.clear();
+
+  // perm_[j, end) holds the positions still eligible
+  size_t end = perm_.size();
+  for ( size_t j = 0 ; drawn.size() < k ; )
+  {
+    if ( j == end )
+    {
+      // restore identity before throwing, the sampler may be reused
+      for ( size_t s = swaps_.size() ; s > 0 ; --s )
+        std::swap(perm_[swaps_[s - 1].first], perm_[swaps_[s - 1].second]);
+      throw BadProperty("Cannot draw enough distinct nodes without autapses and multapses.");
+    }
+
+    const size_t r = j + rng->ulrand(end - j);
+    std::swap(perm_[j], perm_[r]);
+    swaps_.push_back(std::make_pair(j, r));
+
+    if ( pool[perm_[j]] == excluded )
+    {
+      // move excluded position out of the eligible range and draw again
+      --end;
+      std::swap(perm_[j], perm_[end]);
+      swaps_.push_back(std::make_pair(j, end));
+      continue;
+    }
+
+    drawn.push_back(perm_[j]);
+    ++j;
+  }
+
+  // undo swaps in reverse order to restore the identity permutation
+  for ( size_t s = swaps_.size() ; s > 0 ; --s )
+    std::swap(perm_[swaps_[s - 1].first], perm_[swaps_[s - 1].second]);
+}
+
 nest::FixedInDegreeBuilder::FixedInDegreeBuilder(Network& net,
 					         const GIDCollection& sources, 
 					         const GIDCollection& targets, 
@@ -458,6 +541,10 @@ void nest::FixedInDegreeBuilder::connect_()
       // allocate pointer to thread specific random generator
       librandom::RngPtr rng = net_.get_rng(tid); 
 
+      // without multapses, sources are drawn without replacement
+      PositionSampler sampler(multapses_ ? 0 : sources_.size());
+      std::vector<index> s_ids;
+
       for (GIDCollection::const_iterator 
          tgid = targets_.begin();
          tgid != targets_.end();
@@ -475,26 +562,28 @@ void nest::FixedInDegreeBuilder::connect_()
         if( tid != target_thread)
           continue;
 
-        std::set<long> ch_ids;
-        long n_rnd = sources_.size();
+        reserve_(tid, indegree_);
 
-        for (long j = 0; j < indegree_; ++j)
+        if ( multapses_ )
         {
-          unsigned long s_id;
-          index sgid;
-
-          do 
+          const long n_rnd = sources_.size();
+          for (long j = 0; j < indegree_; ++j)
           {
-            s_id  = rng->ulrand(n_rnd);
-            sgid = sources_[s_id];
-          }
-          while (( not autapses_ and sgid == *tgid ) ||
-                 ( not multapses_ and ch_ids.find( s_id ) != ch_ids.end()));
+            index sgid;
+            do
+              sgid = sources_[rng->ulrand(n_rnd)];
+            while ( not autapses_ and sgid == *tgid );
 
-          if (not multapses_)
-            ch_ids.insert(s_id);
-
-          single_connect_(sgid, *target, target_thread, rng);
+            single_connect_(sgid, *target, target_thread, rng);
+          }
+        }
+        else
+        {
+          sampler.draw(rng, indegree_, sources_,
+                       autapses_ ? invalid_index : *tgid, s_ids);
+          for ( std::vector<index>::const_iterator s_id = s_ids.begin();
+                s_id != s_ids.end(); ++s_id )
+            single_connect_(sources_[*s_id], *target, target_thread, rng);
         }
       }
     }
@@ -528,75 +617,120 @@ nest::FixedOutDegreeBuilder::FixedOutDegreeBuilder(Network& net,
 
 void nest::FixedOutDegreeBuilder::connect_()
 {
+  // The targets of the source at position s are drawn from substream s
+  // of a Philox generator keyed by a single number from the global RNG.
+  // All threads can thus draw targets in parallel, and the connections
+  // depend only on the state of the global RNG, not on the number of
+  // threads. Sources are processed in blocks: the threads draw the
+  // targets of all sources in a block, then each thread creates the
+  // connections to its own targets.
   librandom::RngPtr grng = net_.get_grng();
+  const unsigned long key = grng->ulrand(0xffffffffUL);
+
+  const size_t n_sources = sources_.size();
+  const size_t n_threads = net_.get_num_threads();
+  std::vector<std::vector<index> > tgt_ids(SOURCE_BLOCK_SIZE_);
+  std::vector<int> draw_failed(n_threads, 0);
+
+  #pragma omp parallel
+  {
+    // get thread id
+    const int tid = net_.get_thread_id();
+
+    // allocate pointer to thread specific random generator
+    librandom::RngPtr rng = net_.get_rng(tid);
+
+    librandom::Philox* const philox = new librandom::Philox(key);
+    librandom::RngPtr srng(philox);
+
+    // without multapses, targets are drawn without replacement
+    PositionSampler sampler(multapses_ ? 0 : targets_.size());
+
+    for ( size_t b = 0 ; b < n_sources ; b += SOURCE_BLOCK_SIZE_ )
+    {
+      const size_t b_end = std::min(b + SOURCE_BLOCK_SIZE_, n_sources);
 
-  for (GIDCollection::const_iterator 
-       sgid = sources_.begin();
-       sgid != sources_.end();
-       ++sgid 
-       )
-    { 
-      std::set<long> ch_ids;
-      std::vector<index> tgt_ids_;
-      const long n_rnd = targets_.size();
-      
-      for ( long j = 0; j < outdegree_ ; ++j )
+      // Exceptions must not leave the loop, since all threads need
+      // to reach the barriers.
+      try
+      {
+        for ( size_t s = b + tid ; s < b_end ; s += n_threads )
         {
-	  unsigned long t_id;
-	  index tgid;
-	  
-	  do 
+          const index sgid = sources_[s];
+          std::vector<index>& t_ids = tgt_ids[s - b];
+
+          philox->set_substream(s, 0);
+          if ( multapses_ )
+          {
+            const long n_rnd = targets_.size();
+            t_ids.resize(outdegree_);
+            for ( long j = 0 ; j < outdegree_ ; ++j )
             {
-              t_id  = grng->ulrand(n_rnd);
-              tgid = targets_[t_id];
+              do
+                t_ids[j] = srng->ulrand(n_rnd);
+              while ( not autapses_ and targets_[t_ids[j]] == sgid );
             }
-	    while (( not autapses_ and tgid == *sgid ) ||
-	       	   ( not multapses_ and ch_ids.find( t_id ) != ch_ids.end()));
-
-          if (not multapses_)
-            ch_ids.insert(t_id);
-	  
-	  tgt_ids_.push_back(tgid);
-	 }
-      
-    #pragma omp parallel
+          }
+          else
+            sampler.draw(srng, outdegree_, targets_,
+                         autapses_ ? invalid_index : sgid, t_ids);
+        }
+      }
+      catch ( std::exception& err )
       {
-        // get thread id
-        const int tid = net_.get_thread_id();
-
-        try
-	{
-          // allocate pointer to thread specific random generator
-          librandom::RngPtr rng = net_.get_rng(tid);
-
-          for (std::vector<index>::const_iterator 
-               tgid = tgt_ids_.begin();
-               tgid != tgt_ids_.end();
-               ++tgid 
-               )
-            {
-              // check whether the target is on this mpi machine
-              if (!net_.is_local_gid(*tgid))
-                continue;
+        // We must create a new exception here, err's lifetime ends at
+        // the end of the catch block.
+        exceptions_raised_.at(tid) = lockPTR<WrappedThreadException>(new WrappedThreadException(err));
+        draw_failed[tid] = 1;
+      }
 
-              Node * const target = net_.get_node(*tgid);
-              const thread target_thread = target->get_thread();
+      #pragma omp barrier
 
-	      // check whether the target is on our thread  
-              if( tid != target_thread)
-                continue;
+      // stop on all threads if drawing failed on any thread
+      bool failed = false;
+      for ( size_t t = 0 ; t < n_threads ; ++t )
+        failed = failed || draw_failed[t];
 
-              single_connect_(*sgid, *target, target_thread, rng);
-            }
-        }
-        catch ( std::exception& err )
+      try
+      {
+        for ( size_t s = b ; s < b_end && not failed ; ++s )
         {
-          // We must create a new exception here, err's lifetime ends at
-          // the end of the catch block.
-          exceptions_raised_.at(tid) = lockPTR<WrappedThreadException>(new WrappedThreadException(err));
+          const std::vector<index>& t_ids = tgt_ids[s - b];
+          for ( std::vector<index>::const_iterator t_id = t_ids.begin();
+                t_id != t_ids.end(); ++t_id )
+          {
+            const index tgid = targets_[*t_id];
+
+            // check whether the target is on this mpi machine
+            if (!net_.is_local_gid(tgid))
+              continue;
+
+            Node * const target = net_.get_node(tgid);
+            const thread target_thread = target->get_thread();
+
+            // check whether the target is on our thread  
+            if( tid != target_thread)
+              continue;
+
+            single_connect_(sources_[s], *target, target_thread, rng);
+          }
         }
-      }  
-    }  
+      }
+      catch ( std::exception& err )
+      {
+        // We must create a new exception here, err's lifetime ends at
+        // the end of the catch block.
+        exceptions_raised_.at(tid) = lockPTR<WrappedThreadException>(new WrappedThreadException(err));
+      }
+
+      // targets of this block must not be overwritten before all
+      // threads have connected them
+      #pragma omp barrier
+
+      if ( failed )
+        break;
+    }
+  }
 }
 
 nest::FixedTotalNumberBuilder::FixedTotalNumberBuilder(Network& net,
@@ -702,6 +836,8 @@ void nest::FixedTotalNumberBuilder::connect_()
       {
         librandom::RngPtr rng = net_.get_rng(tid);
 
+        reserve_(tid, num_conns_on_vp[vp_id]);
+
         while( num_conns_on_vp[vp_id] > 0 )
         {
 
@@ -761,6 +897,12 @@ void nest::BernoulliBuilder::connect_()
       // allocate pointer to thread specific random generator
       librandom::RngPtr rng = net_.get_rng(tid);
 
+      const size_t n_sources = sources_.size();
+
+      // log(1-p), which is -inf for p >= 1 and 0 for p <= 0
+      const double log_q = p_ >= 1.0 ? -std::numeric_limits<double>::infinity()
+                                     : numerics::log1p(-std::max(p_, 0.0));
+
       for (GIDCollection::const_iterator 
            tgid = targets_.begin();
            tgid != targets_.end();
@@ -778,22 +920,25 @@ void nest::BernoulliBuilder::connect_()
         if( tid != target_thread)
           continue;
 
-        for ( GIDCollection::const_iterator 
-              sgid = sources_.begin();
-              sgid != sources_.end();
-              ++sgid )
-          {
-            // not possible to create multapses with this implementation,
-            // hence leave out the check for BernoulliBuilder
+        // Instead of testing each source, we draw the number of sources
+        // skipped before the next accepted source, which is geometrically
+        // distributed: P(gap = k) = (1-p)^k p. The work is thus proportional
+        // to the number of connections created. An accepted source equal to
+        // the target is dropped if autapses are excluded, so that all other
+        // pairs are still accepted independently with probability p.
+        // It is not possible to create multapses with this implementation,
+        // hence leave out the check for BernoulliBuilder.
+        for ( size_t s = next_source_(rng, 0, n_sources, log_q) ;
+              s < n_sources ;
+              s = next_source_(rng, s + 1, n_sources, log_q) )
+        {
+          const index sgid = sources_[s];
 
-            if (not autapses_ and *sgid == *tgid)
-              continue;
+          if (not autapses_ and sgid == *tgid)
+            continue;
 
-            if (not ( rng->drand() < p_ ))
-              continue;
-
-            single_connect_(*sgid, *target, target_thread, rng);
-          }
+          single_connect_(sgid, *target, target_thread, rng);
+        }
       }
     }
     catch ( std::exception& err )
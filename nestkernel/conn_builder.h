@@ -31,7 +31,9 @@
  *
  */
 
+#include <cmath>
 #include <map>
+#include <utility>
 #include <vector>
 
 #include "dictdatum.h"
@@ -86,6 +88,14 @@ namespace nest {
     //! Create connection between given nodes, fill parameter values
     void single_connect_(index, Node&, thread, librandom::RngPtr&);
 
+    /**
+     * Announce that thread will create n more connections.
+     *
+     * Random parameters then draw their values in blocks. Call only with
+     * the exact number of connections or a lower bound.
+     */
+    void reserve_(thread, size_t);
+
     Network& net_;
 
     const GIDCollection& sources_;
@@ -155,6 +165,35 @@ namespace nest {
   };
 
 
+  /**
+   * Draw positions in a GIDCollection without replacement.
+   *
+   * Uses a partial Fisher-Yates shuffle of a buffer holding the
+   * identity permutation. The swaps are undone after each draw, so that
+   * the buffer is set up only once, each draw of k positions costs O(k)
+   * independent of the size of the collection, and the positions drawn
+   * depend only on the random numbers used. Each thread needs its own
+   * sampler.
+   */
+  class PositionSampler
+  {
+  public:
+    //! Set up sampler for collections of size n
+    PositionSampler(size_t n);
+
+    /**
+     * Draw k distinct positions of pool into drawn, skipping all positions
+     * holding the GID excluded. Pass invalid_index to exclude nothing.
+     * Throws BadProperty if fewer than k positions are eligible.
+     */
+    void draw(librandom::RngPtr&, size_t k, const GIDCollection& pool,
+              index excluded, std::vector<index>& drawn);
+
+  private:
+    std::vector<index> perm_;  //!< identity permutation between draws
+    std::vector<std::pair<size_t, size_t> > swaps_;  //!< swaps of last draw
+  };
+
   class FixedInDegreeBuilder : public ConnBuilder
   {
   public:
@@ -185,6 +224,9 @@ namespace nest {
 
   private:
     long outdegree_;   
+
+    //! number of sources whose targets are drawn at once
+    static const size_t SOURCE_BLOCK_SIZE_ = 256;
   };
 
   class FixedTotalNumberBuilder : public ConnBuilder
@@ -217,8 +259,27 @@ namespace nest {
 
   private:
     double p_;   //!< connection probability
+
+    /**
+     * Return position of next accepted source at or after pos, or n if
+     * there is none, by drawing a geometrically distributed gap.
+     * @param log_q log(1-p)
+     */
+    size_t next_source_(librandom::RngPtr&, size_t pos, size_t n, double log_q) const;
   };
 
+  inline
+  size_t BernoulliBuilder::next_source_(librandom::RngPtr& rng, size_t pos, size_t n,
+                                        double log_q) const
+  {
+    if ( pos >= n || log_q == 0.0 )
+      return n;
+
+    // 1 - drand() lies in (0, 1], so that the logarithm is finite
+    const double gap = std::floor(std::log(1.0 - rng->drand()) / log_q);
+    return gap < static_cast<double>(n - pos) ? pos + static_cast<size_t>(gap) : n;
+  }
+
   
 }  // namespace nest
 
@@ -29,7 +29,9 @@
 #include "nest_names.h"
 #include "tokenutils.h"
 
-nest::ConnParameter* nest::ConnParameter::create(const Token& t)
+const size_t nest::RandomParameter::BLOCK_SIZE_ = 256;
+
+nest::ConnParameter* nest::ConnParameter::create(const Token& t, const size_t nthreads)
 {
   // Code grabbed from TopologyModule::create_parameter()
   // See there for a more general solution
@@ -42,7 +44,7 @@ nest::ConnParameter* nest::ConnParameter::create(const Token& t)
   // random deviate
   DictionaryDatum *rdv_spec = dynamic_cast<DictionaryDatum*>(t.datum());
   if ( rdv_spec )
-    return new RandomParameter(*rdv_spec);
+    return new RandomParameter(*rdv_spec, nthreads);
 
   // single integer
   IntegerDatum *id = dynamic_cast<IntegerDatum*>(t.datum());
@@ -58,8 +60,9 @@ nest::ConnParameter* nest::ConnParameter::create(const Token& t)
   throw BadProperty("Cannot handle parameter type.");
 }
 
-nest::RandomParameter::RandomParameter(const DictionaryDatum& rdv_spec)
-  : rdv_(0)
+nest::RandomParameter::RandomParameter(const DictionaryDatum& rdv_spec, const size_t nthreads)
+  : rdv_(0),
+    buffers_(nthreads)
 {
   if ( !rdv_spec->known(names::distribution) )
     throw BadProperty("Random distribution spec must contain distribution name.");
@@ -23,6 +23,7 @@
 #ifndef CONN_PARAMETER_H
 #define CONN_PARAMETER_H
 
+#include <algorithm>
 #include <limits>
 #include <vector>
 
@@ -57,16 +58,26 @@ namespace nest
      *
      * The parameter value may depend on source and target GIDs
      * (when using callback functions, not yet implemented)
-     * and random numbers. All three must be supplied, even if
+     * and random numbers. All must be supplied, even if
      * a concrete parameter type does not use them.
      *
+     * @param thrd  thread calling the function, must be the thread of rng
      * @param sgid  source gid
      * @param tgid  target gid
      * @param rng   random number generator pointer
      * will be ignored except for random parameters.
      */
-    virtual double value_double(index, index, librandom::RngPtr&) const =0;       
-    virtual long_t value_int(index, index, librandom::RngPtr&) const =0;
+    virtual double value_double(thread, index, index, librandom::RngPtr&) const =0;       
+    virtual long_t value_int(thread, index, index, librandom::RngPtr&) const =0;
+
+    /**
+     * Announce that thread thrd will request n more values.
+     *
+     * Random parameters draw announced values in blocks. The announced
+     * count must not exceed the number of values actually requested,
+     * otherwise values are drawn that are never used.
+     */
+    virtual void reserve(thread, size_t) {}
 
     /**
      * Returns number of values available.
@@ -75,7 +86,11 @@ namespace nest
      */
     virtual size_t number_of_values() const { return 0; }
 
-    static ConnParameter* create(const Token&);
+    /**
+     * Create parameter from token.
+     * @param nthreads  number of threads that will request values
+     */
+    static ConnParameter* create(const Token&, const size_t nthreads);
   };
 
 
@@ -89,8 +104,8 @@ namespace nest
   public:
     ScalarDoubleParameter(double value) : value_(value) {}
 
-    double value_double(index, index, librandom::RngPtr&) const { return value_; }
-    long_t value_int(index, index, librandom::RngPtr&) const { throw KernelException("ConnParameter calls value function with false return type."); }
+    double value_double(thread, index, index, librandom::RngPtr&) const { return value_; }
+    long_t value_int(thread, index, index, librandom::RngPtr&) const { throw KernelException("ConnParameter calls value function with false return type."); }
 
   private:
     double value_;
@@ -106,8 +121,8 @@ namespace nest
   public:
     ScalarIntegerParameter(long_t value) : value_(value) {}
 
-    double value_double(index, index, librandom::RngPtr&) const { throw KernelException("ConnParameter calls value function with false return type."); }
-    long_t value_int(index, index, librandom::RngPtr&) const { return value_; }
+    double value_double(thread, index, index, librandom::RngPtr&) const { throw KernelException("ConnParameter calls value function with false return type."); }
+    long_t value_int(thread, index, index, librandom::RngPtr&) const { return value_; }
 
   private:
     long_t value_;
@@ -132,7 +147,7 @@ namespace nest
     size_t number_of_values() const { return values_.size(); }
 
     //double value(index sgid, index tgid, librandom::RngPtr&) const 
-    double value_double(index, index, librandom::RngPtr&) const 
+    double value_double(thread, index, index, librandom::RngPtr&) const 
    
     { 
       //return values_[sgid];
@@ -141,7 +156,7 @@ namespace nest
       else 
 	throw KernelException("Parameter values exhausted.");
     }
-    long_t value_int(index, index, librandom::RngPtr&) const { throw KernelException("ConnParameter calls value function with false return type."); }
+    long_t value_int(thread, index, index, librandom::RngPtr&) const { throw KernelException("ConnParameter calls value function with false return type."); }
 
   private:
     std::vector<double> values_;
@@ -153,19 +168,64 @@ namespace nest
    * Random scalar value.
    *
    * On each request, it returns a new value drawn from the given deviate.
+   * Values announced by reserve() are drawn in blocks of at most
+   * BLOCK_SIZE_ per thread, using RandomDev::fill(). Blocks never extend
+   * beyond the announced values, so no value is drawn that is not
+   * returned. Values that were not announced are drawn one at a time.
    */
   class RandomParameter: public ConnParameter
   {
   public:
-    RandomParameter(const DictionaryDatum&);
+    RandomParameter(const DictionaryDatum&, const size_t nthreads);
 
-    double value_double(index, index, librandom::RngPtr& rng) const { return (*rdv_)(rng); }
-    long_t value_int(index, index, librandom::RngPtr& rng) const { return (*rdv_)(rng); }
+    double value_double(thread thrd, index, index, librandom::RngPtr& rng) const { return next_value_(thrd, rng); }
+    long_t value_int(thread thrd, index, index, librandom::RngPtr& rng) const { return next_value_(thrd, rng); }
+
+    void reserve(thread thrd, size_t n) { buffers_[thrd].reserved += n; }
 
   private:
+    static const size_t BLOCK_SIZE_;
+
+    //! Values drawn in advance for one thread
+    struct Buffer_
+    {
+      Buffer_() : values(), next(0), reserved(0) {}
+
+      std::vector<double> values;
+      size_t next;      //!< next value to return
+      size_t reserved;  //!< announced values not yet drawn
+
+      //! keeps the counters of different threads on separate cache lines
+      char padding[64];
+    };
+
+    //! Return next value from buffer of thread, refill if exhausted
+    double next_value_(thread, librandom::RngPtr&) const;
+
     librandom::RdvPtr rdv_;
+
+    //! One buffer per thread
+    mutable std::vector<Buffer_> buffers_;
   };
 
+  inline
+  double RandomParameter::next_value_(thread thrd, librandom::RngPtr& rng) const
+  {
+    Buffer_& buffer = buffers_[thrd];
+    if ( buffer.next == buffer.values.size() )
+    {
+      if ( buffer.reserved == 0 )
+        return (*rdv_)(rng);
+
+      const size_t n = std::min(buffer.reserved, BLOCK_SIZE_);
+      buffer.values.resize(n);
+      rdv_->fill(rng, &buffer.values[0], n);
+      buffer.reserved -= n;
+      buffer.next = 0;
+    }
+    return buffer.values[buffer.next++];
+  }
+
 }  // namespace nest
 
 #endif
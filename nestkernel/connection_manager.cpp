@@ -342,6 +342,14 @@ void ConnectionManager::get_connections(ArrayDatum& connectome, TokenArray const
 
   connectome.reserve(num_connections);
 
+  // Every thread collects its connections in an array of its own. The
+  // arrays are created here, so that the parallel regions do not share
+  // any TokenArray and need no critical sections.
+  std::vector<ArrayDatum> conns_per_thread;
+  conns_per_thread.reserve(net_.get_num_threads());
+  for (thread t = 0; t < net_.get_num_threads(); ++t)
+    conns_per_thread.push_back(ArrayDatum());
+
   if (source==0 and target == 0)
   {
 #ifdef _OPENMP
@@ -352,7 +360,7 @@ void ConnectionManager::get_connections(ArrayDatum& connectome, TokenArray const
     for (thread t = 0; t < net_.get_num_threads(); ++t)
     {
 #endif
-      ArrayDatum conns_in_thread;
+      ArrayDatum& conns_in_thread = conns_per_thread[t];
       size_t num_connections_in_thread = 0;
       // Count how many connections we will have.
       for(tSConnector::const_nonempty_iterator it=connections_[t].nonempty_begin(); it != connections_[t].nonempty_end(); ++it)
@@ -360,25 +368,13 @@ void ConnectionManager::get_connections(ArrayDatum& connectome, TokenArray const
         num_connections_in_thread += (*it)->get_num_connections();
       }
 		
-#ifdef _OPENMP
-#pragma omp critical
-#endif
       conns_in_thread.reserve(num_connections_in_thread);
       for (index source_id=1; source_id< connections_[t].size(); ++source_id)
       {
         if(connections_[t].get(source_id) != 0)
           connections_[t].get(source_id)->get_connections(source_id, t, syn_id,conns_in_thread);
       }
-      if (conns_in_thread.size()>0)
-      {
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-        connectome.append_move(conns_in_thread);
-      }
     }
-
-    return;
   }
   else if(source == 0 and target !=0)
   {
@@ -390,7 +386,7 @@ void ConnectionManager::get_connections(ArrayDatum& connectome, TokenArray const
     for (thread t = 0; t < net_.get_num_threads(); ++t)
     {
 #endif
-      ArrayDatum conns_in_thread;
+      ArrayDatum& conns_in_thread = conns_per_thread[t];
       size_t num_connections_in_thread=0;
       // Count how many connections we will have maximally.
       for(tSConnector::const_nonempty_iterator it=connections_[t].nonempty_begin(); it != connections_[t].nonempty_end(); ++it)
@@ -398,9 +394,6 @@ void ConnectionManager::get_connections(ArrayDatum& connectome, TokenArray const
 		num_connections_in_thread += (*it)->get_num_connections();     
       }
 		
-#ifdef _OPENMP
-#pragma omp critical
-#endif
       conns_in_thread.reserve(num_connections_in_thread);
       for (index source_id=1; source_id< connections_[t].size(); ++source_id)
       {  
@@ -413,15 +406,7 @@ void ConnectionManager::get_connections(ArrayDatum& connectome, TokenArray const
           }
         }
       }
-      if (conns_in_thread.size()>0)
-      {
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-        connectome.append_move(conns_in_thread);
-      }
     }
-    return;
   }
   else if(source !=0 )
   {
@@ -433,7 +418,7 @@ void ConnectionManager::get_connections(ArrayDatum& connectome, TokenArray const
     for (thread t = 0; t < net_.get_num_threads(); ++t)
     {
 #endif
-      ArrayDatum conns_in_thread;
+      ArrayDatum& conns_in_thread = conns_per_thread[t];
       size_t num_connections_in_thread=0;
       // Count how many connections we will have maximally.
       for(tSConnector::const_nonempty_iterator it=connections_[t].nonempty_begin(); it != connections_[t].nonempty_end(); ++it)
@@ -441,9 +426,6 @@ void ConnectionManager::get_connections(ArrayDatum& connectome, TokenArray const
 		num_connections_in_thread += (*it)->get_num_connections();
       }
 		
-#ifdef _OPENMP
-#pragma omp critical
-#endif
       conns_in_thread.reserve(num_connections_in_thread);
       for( index s=0; s< source->size(); ++s)
       {
@@ -464,17 +446,12 @@ void ConnectionManager::get_connections(ArrayDatum& connectome, TokenArray const
           }
         }
       }
-	    
-      if (conns_in_thread.size()>0)
-      {
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-        connectome.append_move(conns_in_thread);
-      }
     }
-    return;
   } // else
+
+  for (thread t = 0; t < net_.get_num_threads(); ++t)
+    if (conns_per_thread[t].size()>0)
+      connectome.append_move(conns_per_thread[t]);
 }
 
 ConnectorBase* ConnectionManager::validate_source_entry(thread tid, index s_gid, synindex syn_id)
@@ -528,6 +505,9 @@ void ConnectionManager::connect(Node& s, Node& r, index s_gid, thread tid, index
   ConnectorBase* conn = validate_source_entry(tid, s_gid, syn);
   ConnectorBase* c = prototypes_[tid][syn]->add_connection(s, r, conn, syn, d, w);
   connections_[tid].set(s_gid, c);
+
+  // targets set up their data loggers for multimeters in calibrate()
+  net_.request_calibration(r);
 }
 
 void ConnectionManager::connect(Node& s, Node& r, index s_gid, thread tid, index syn, DictionaryDatum& p, double_t d, double_t w)
@@ -536,6 +516,8 @@ void ConnectionManager::connect(Node& s, Node& r, index s_gid, thread tid, index
   ConnectorBase* conn = validate_source_entry(tid, s_gid, syn);
   ConnectorBase* c = prototypes_[tid][syn]->add_connection(s, r, conn, syn, p, d, w);
   connections_[tid].set(s_gid, c);
+
+  net_.request_calibration(r);
 }
 
 /**
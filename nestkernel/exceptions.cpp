@@ -219,11 +219,21 @@ std::string nest::SubnetExpected::message()
   return std::string();
 }
 
+std::string nest::RecorderExpected::message()
+{
+  return std::string("Recorded events can only be taken from recording devices.");
+}
+
 std::string nest::SimulationError::message()
 {
   return std::string("One or more nodes reported an error. Please check the output preceeding this message.");
 }
 
+std::string nest::SimulationInterrupted::message()
+{
+  return std::string("The simulation was interrupted. Use ResumeSimulation to continue it.");
+}
+
 std::string nest::InvalidDefaultResolution::message()
 {
   std::ostringstream msg;
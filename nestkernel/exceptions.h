@@ -519,6 +519,21 @@ namespace nest {
     std::string message();
   };
 
+  /**
+   * Exception to be thrown if recorded data is requested from
+   * a node that is not a recording device.
+   * @ingroup KernelExceptions
+   */
+  class RecorderExpected: public KernelException
+  {
+  public:
+  RecorderExpected()
+    : KernelException("RecorderExpected") {}
+    ~RecorderExpected() throw () {}
+    
+    std::string message();
+  };
+
   /**
    * Exception to be thrown if the wrong argument type
    * is given to a function
@@ -533,6 +548,21 @@ namespace nest {
     
     std::string message();
   };
+
+  /**
+   * Exception to be thrown if a simulation was stopped by
+   * Scheduler::interrupt().
+   * @ingroup KernelExceptions
+   */
+  class SimulationInterrupted: public KernelException
+  {
+  public:
+  SimulationInterrupted()
+    : KernelException("SimulationInterrupted") {}
+    ~SimulationInterrupted() throw () {}
+
+    std::string message();
+  };
   
   /**
    * Exception to be thrown on prototype construction if Time objects incompatible.
@@ -45,6 +45,11 @@ namespace nest
 
     const Name b("b");
     const Name beta("beta");
+    const Name bg_rate_ex("bg_rate_ex");
+    const Name bg_rate_in("bg_rate_in");
+    const Name bg_weight_ex("bg_weight_ex");
+    const Name bg_weight_in("bg_weight_in");
+    const Name bin_width("bin_width");
     const Name binary("binary");
 
     const Name c("c");
@@ -55,6 +60,7 @@ namespace nest
     const Name C_m("C_m");
     const Name calibrate("calibrate");
     const Name calibrate_node("calibrate_node");
+    const Name chunk_size("chunk_size");
     const Name clear("clear");
     const Name close_after_simulate("close_after_simulate");
     const Name close_on_reset("close_on_reset");
@@ -113,6 +119,7 @@ namespace nest
     const Name events("events");
     const Name ex_spikes("ex_spikes");
     const Name exc_conductance("exc_conductance");
+    const Name execute_node("execute_node");
 
     const Name F_lower("F_lower");
     const Name F_mean("F_mean");
@@ -170,6 +177,8 @@ namespace nest
     const Name Interpol_Order("Interpol_Order");
     const Name interval("interval");
     const Name is_refractory("is_refractory");
+    const Name isi_cv("isi_cv");
+    const Name isi_mean("isi_mean");
 
     const Name label("label");
     const Name len_kernel("len_kernel");
@@ -192,6 +201,7 @@ namespace nest
     const Name N_channels("N_channels");
     const Name n_events("n_events");
     const Name n_proc("n_proc");
+    const Name n_spikes("n_spikes");
     const Name neuron("neuron");
     const Name noise("noise");
     const Name ns("ns");
@@ -225,6 +235,7 @@ namespace nest
     const Name q_sfa("q_sfa");
 
     const Name rate("rate");
+    const Name rates("rates");
     const Name receptor_type("receptor_type");
     const Name receptor_types("receptor_types");
     const Name record_from("record_from");
@@ -57,6 +57,11 @@ namespace nest
 
     extern const Name b;                        //!< Specific to Brette & Gerstner 2005 (aeif_cond-*)
     extern const Name beta;                     //!< Specific to amat2_*
+    extern const Name bg_rate_ex;               //!< Specific to iaf_psc_alpha
+    extern const Name bg_rate_in;               //!< Specific to iaf_psc_alpha
+    extern const Name bg_weight_ex;             //!< Specific to iaf_psc_alpha
+    extern const Name bg_weight_in;             //!< Specific to iaf_psc_alpha
+    extern const Name bin_width;                //!< Recorder parameter (spike_detector)
     extern const Name binary;                   //!< Recorder parameter
 
     extern const Name c;                        //!< Specific to Izhikevich 2003
@@ -67,6 +72,7 @@ namespace nest
     extern const Name C_m;                      //!< Membrane capacitance
     extern const Name calibrate;                //!< Command to calibrate the neuron (sli_neuron)
     extern const Name calibrate_node;           //!< Command to calibrate the neuron (sli_neuron)
+    extern const Name chunk_size;               //!< Recorder parameter (spike_detector)
     extern const Name clear;                    //!< used for ArchivingNode
     extern const Name close_after_simulate;     //!< Recorder parameter
     extern const Name close_on_reset;           //!< Recorder parameter
@@ -125,6 +131,7 @@ namespace nest
     extern const Name events;                   //!< Recorder parameter
     extern const Name ex_spikes;                //!< Number of arriving excitatory spikes
     extern const Name exc_conductance;          //!< Recorder parameter
+    extern const Name execute_node;             //!< Command to execute a procedure of the neuron (sli_neuron)
 
     extern const Name F_lower;
     extern const Name F_mean;
@@ -182,6 +189,8 @@ namespace nest
     extern const Name Interpol_Order;           //!< Interpolation order (precise timing neurons)
     extern const Name interval;                 //!< Recorder parameter
     extern const Name is_refractory;            //!< Neuron is in refractory period (debugging)
+    extern const Name isi_cv;                   //!< Recorder parameter (spike_detector)
+    extern const Name isi_mean;                 //!< Recorder parameter (spike_detector)
 
     extern const Name label;                    //!< Miscellaneous parameters
     extern const Name len_kernel;               //!< Specific to population point process model (pp_pop_psc_delta)
@@ -204,6 +213,7 @@ namespace nest
     extern const Name N_channels;               //!< Specific to correlomatrix_detector
     extern const Name n_events;                 //!< Recorder parameter
     extern const Name n_proc;                   //!< Number of component processes of ppd_sup_/gamma_sup_generator
+    extern const Name n_spikes;                 //!< Recorder parameter (spike_detector)
     extern const Name neuron;                   //!< Node type
     extern const Name noise;                    //!< Specific to iaf_chs_2008 neuron
     extern const Name ns;                       //!< Number of release sites (property arrays)
@@ -237,6 +247,7 @@ namespace nest
     extern const Name q_sfa;                    //!< Other adaptation
 
     extern const Name rate;                     //!< Specific to ppd_sup_generator and gamma_sup_generator
+    extern const Name rates;                    //!< Recorder parameter (spike_detector)
     extern const Name receptor_type;            //!< Connection parameters
     extern const Name receptor_types;           //!< Connection parameters
     extern const Name record_from;              //!< Recorder parameter
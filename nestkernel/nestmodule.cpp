@@ -360,6 +360,34 @@ namespace nest
     i->EStack.pop();
   }
 
+  /* BeginDocumentation
+     Name: TakeEvents - return and clear the events recorded by a recording device
+     Synopsis: 
+     gid TakeEvents -> dict
+
+     Description:
+     TakeEvents returns the dictionary of events recorded by a recording
+     device, like gid GetStatus /events get, and clears the events from the
+     device, like setting /n_events to 0. In contrast to GetStatus, the 
+     recorded data is handed over without copying where possible. This 
+     allows long simulations to collect recorded data incrementally 
+     between calls to Simulate without keeping all data in the device.
+
+     Availability: NEST
+     SeeAlso: GetStatus, spike_detector, multimeter
+  */
+  void NestModule::TakeEvents_iFunction::execute(SLIInterpreter *i) const
+  {
+    i->assert_stack_load(1);
+     
+    index node_id = getValue<long>(i->OStack.pick(0));  
+    DictionaryDatum dict = get_network().take_events(node_id);
+
+    i->OStack.pop();
+    i->OStack.push(dict);
+    i->EStack.pop();
+  }
+
   void NestModule::GetStatus_CFunction::execute(SLIInterpreter *i) const
   {
     i->assert_stack_load(1);
@@ -562,6 +590,80 @@ namespace nest
     i->EStack.pop();
   }
 
+  /* BeginDocumentation
+     Name: Prepare - prepare the network for a sequence of Run calls
+
+     Synopsis:
+     Prepare -> -
+
+     Description:
+     Prepare does once what Simulate does before each simulation, so
+     that the network can then be simulated in many short steps with
+     Run. This makes short steps cheap, e.g. in a closed loop with
+     another program. A sequence of Run calls must be ended with
+     Cleanup, before Simulate can be used again.
+
+     Run prepares the network again only if nodes were added or
+     changed, e.g. by SetStatus or Connect, and then calibrates only
+     the changed nodes and the devices. ResetNetwork must not be
+     called between Prepare and Cleanup.
+
+     Example:
+     Prepare
+     100 { 1.0 Run } repeat
+     Cleanup
+
+     SeeAlso: Run, Cleanup, Simulate
+  */
+  void NestModule::PrepareFunction::execute(SLIInterpreter *i) const
+  {
+    get_network().prepare();
+    i->EStack.pop();
+  }
+
+  /* BeginDocumentation
+     Name: Run - simulate n milliseconds after Prepare
+
+     Synopsis:
+     n(int) Run -> -
+
+     Description:
+     Simulate the network for n milliseconds, without the preparation
+     and cleanup Simulate does. Run must be preceded by Prepare.
+     Recording devices write their data to file only at Cleanup.
+
+     SeeAlso: Prepare, Cleanup, Simulate
+  */
+  void NestModule::RunFunction::execute(SLIInterpreter *i) const
+  {
+    i->assert_stack_load(1);
+
+    const double time = i->OStack.top();
+
+    get_network().run(Time::ms(time));
+
+    i->OStack.pop();
+    i->EStack.pop();
+  }
+
+  /* BeginDocumentation
+     Name: Cleanup - end a sequence of Run calls
+
+     Synopsis:
+     Cleanup -> -
+
+     Description:
+     Finalize the nodes after a sequence of Run calls started by
+     Prepare. Recording devices write out their data.
+
+     SeeAlso: Prepare, Run, Simulate
+  */
+  void NestModule::CleanupFunction::execute(SLIInterpreter *i) const
+  {
+    get_network().cleanup();
+    i->EStack.pop();
+  }
+
   /* BeginDocumentation
      Name: CopyModel - copy a model to a new name, set parameters for copy, if given
      Synopsis:
@@ -1234,9 +1336,17 @@ namespace nest
      Note that MemoryInfo only gives you information about the memory requirements of
      the static model data inside of NEST. It does not tell anything about the memory
      situation on your computer. 
+     For models whose nodes share their parameters with other nodes that have
+     the same values (e.g. iaf_psc_alpha, iaf_psc_exp, iaf_psc_delta),
+     a second table lists the number of local nodes, the number of
+     distinct parameter blocks they use, the memory of these blocks
+     and the memory saved compared to one copy of the parameters per
+     node. Nodes share the parameters of their model until SetStatus
+     changes them.
      Synopsis:
      MemoryInfo -> -
      Availability: NEST
+     SeeAlso: SharedParameterInfo
      Author: Jochen Martin Eppler
   */
   void NestModule::MemoryInfoFunction::execute(SLIInterpreter *i) const
@@ -1245,6 +1355,35 @@ namespace nest
     i->EStack.pop();
   }
 
+  /* BeginDocumentation
+     Name: SharedParameterInfo - Return the sharing of parameters by local nodes.
+     Synopsis:
+     SharedParameterInfo -> dict
+     Description:
+     Returns a dictionary with an entry for each model whose local nodes
+     share their parameters with other nodes that have the same values
+     (e.g. iaf_psc_alpha, iaf_psc_exp, iaf_psc_delta). Each entry is a
+     dictionary with the following entries:
+     /nodes  - number of local nodes of the model
+     /blocks - number of distinct parameter blocks used by these nodes
+     /bytes  - memory of these blocks in bytes
+     /saved  - memory saved compared to one copy of the parameters per
+               node in bytes
+     MemoryInfo prints the same numbers.
+     Examples:
+     /iaf_psc_alpha 10 Create ;
+     2 << /C_m 100.0 >> SetStatus
+     SharedParameterInfo /iaf_psc_alpha get /blocks get -> 2
+     Availability: NEST
+     SeeAlso: MemoryInfo
+  */
+  void NestModule::SharedParameterInfoFunction::execute(SLIInterpreter *i) const
+  {
+    DictionaryDatum info = get_network().get_shared_parameter_info();
+    i->OStack.push(info);
+    i->EStack.pop();
+  }
+
   /* BeginDocumentation
      Name: PrintNetwork - Print network tree in readable form.
      Synopsis: 
@@ -1911,6 +2050,7 @@ namespace nest
     i->createcommand("GetStatus_i",  &getstatus_ifunction);
     i->createcommand("GetStatus_C",  &getstatus_Cfunction);
     i->createcommand("GetStatus_a",  &getstatus_afunction);
+    i->createcommand("TakeEvents_i", &takeevents_ifunction);
 
     i->createcommand("GetConnections_D", &getconnections_Dfunction);
     i->createcommand("cva_C", &cva_cfunction);
@@ -1922,6 +2062,9 @@ namespace nest
     i->createcommand("GetDefaults_l",   &getdefaults_lfunction);
    
     i->createcommand("ResumeSimulation", &resumesimulationfunction);
+    i->createcommand("Prepare", &preparefunction);
+    i->createcommand("Run_d", &runfunction);
+    i->createcommand("Cleanup", &cleanupfunction);
     i->createcommand("Create_l_i", &create_l_ifunction);
    
     i->createcommand("Connect_i_i_l", &connect_i_i_lfunction);
@@ -1944,6 +2087,7 @@ namespace nest
     i->createcommand("ResetKernel",&resetkernelfunction);
 
     i->createcommand("MemoryInfo", &memoryinfofunction);
+    i->createcommand("SharedParameterInfo", &sharedparameterinfofunction);
    
     i->createcommand("PrintNetwork", &printnetworkfunction);
     
@@ -211,6 +211,12 @@ namespace nest
        void execute(SLIInterpreter *) const;
      } getstatus_afunction;
 
+     class TakeEvents_iFunction: public SLIFunction
+     { 
+      public:
+       void execute(SLIInterpreter *) const;
+     } takeevents_ifunction;
+
      class SetStatus_idFunction: public SLIFunction
      { 
       public:
@@ -270,6 +276,24 @@ namespace nest
       public:
        void execute(SLIInterpreter *) const;
      } resumesimulationfunction;
+
+     class PrepareFunction: public SLIFunction
+     { 
+      public:
+       void execute(SLIInterpreter *) const;
+     } preparefunction;
+
+     class RunFunction: public SLIFunction
+     { 
+      public:
+       void execute(SLIInterpreter *) const;
+     } runfunction;
+
+     class CleanupFunction: public SLIFunction
+     { 
+      public:
+       void execute(SLIInterpreter *) const;
+     } cleanupfunction;
   
      class Create_l_iFunction: public SLIFunction
      { 
@@ -366,6 +390,11 @@ namespace nest
        void execute(SLIInterpreter *) const;
      } memoryinfofunction;
 
+     class SharedParameterInfoFunction: public SLIFunction
+     {
+       void execute(SLIInterpreter *) const;
+     } sharedparameterinfofunction;
+
      class PrintNetworkFunction : public SLIFunction
      {
        void execute(SLIInterpreter *) const;
@@ -36,6 +36,7 @@
 #include "dictutils.h"
 #include "tokenutils.h"
 #include "tokenarray.h"
+#include "procedurecode.h"
 #include "exceptions.h"
 #include "sliexceptions.h"
 #include "processes.h"
@@ -271,6 +272,9 @@ void Network::reset_kernel()
 
 void Network::reset_network()
 {
+  if ( scheduler_.get_prepared() )
+    throw KernelException("ResetNetwork cannot be called between Prepare and Cleanup.");
+
   if ( !scheduler_.get_simulated() )
     return;  // nothing to do
 
@@ -295,6 +299,7 @@ void Network::reset_network()
     {
       node->init_state();
       node->set_buffers_initialized(false);
+      request_calibration(*node);
     }
     else if ( node->get_model_id() == -1 )
     {
@@ -304,6 +309,7 @@ void Network::reset_network()
       {
         (*it)->init_state();
         (*it)->set_buffers_initialized(false);
+        request_calibration(**it);
       }
     }
   }
@@ -659,6 +665,21 @@ void Network::resume()
   scheduler_.resume();
 }
 
+void Network::prepare()
+{
+  scheduler_.prepare();
+}
+
+void Network::run(Time const& t)
+{
+  scheduler_.run(t);
+}
+
+void Network::cleanup()
+{
+  scheduler_.cleanup();
+}
+
 void Network::memory_info()
 {
   std::cout.setf(std::ios::left);
@@ -689,9 +710,90 @@ void Network::memory_info()
   }
 
   std::cout << sep << std::endl;
+
+  DictionaryDatum info = get_shared_parameter_info();
+
+  if ( not info->empty() )
+  {
+    std::cout << std::endl
+              << "Shared parameters of local nodes:" << std::endl;
+    std::cout << sep << std::endl;
+    std::cout << std::setw(25) << "Name"
+        << std::setw(8) << "Nodes"
+        << std::setw(8) << "Blocks"
+        << std::setw(9) << "Shared"
+        << "Saved"
+        << std::endl;
+    std::cout << sep << std::endl;
+
+    for ( index i = 0; i < models_.size(); ++i )
+    {
+      const std::string name = models_[idx[i]]->get_name();
+      if ( not info->known(name) )
+        continue;
+
+      DictionaryDatum m = getValue<DictionaryDatum>(info, name);
+      std::cout << std::setw(25) << name
+        << std::setw(8) << getValue<long>(m, "nodes")
+        << std::setw(8) << getValue<long>(m, "blocks")
+        << std::setw(9) << getValue<long>(m, "bytes")
+        << getValue<long>(m, "saved")
+        << std::endl;
+    }
+
+    std::cout << sep << std::endl;
+  }
+
   std::cout.unsetf(std::ios::left);
 }
 
+DictionaryDatum Network::get_shared_parameter_info() const
+{
+  // Count the local nodes and distinct parameter blocks of each model
+  // whose nodes share their parameters. Nodes in SiblingContainers are
+  // devices, which keep their parameters to themselves.
+  std::vector<size_t> num_nodes(models_.size(), 0);
+  std::vector<size_t> block_size(models_.size(), 0);
+  std::vector<long> saving(models_.size(), 0);
+  std::vector<std::set<const void*> > blocks(models_.size());
+
+  for ( size_t n = 0; n < local_nodes_.size(); ++n )
+  {
+    Node* node = local_nodes_.get_node_by_index(n);
+    if ( node == 0 || node->num_thread_siblings_() > 0 || node->get_model_id() < 0 )
+      continue;
+
+    size_t size = 0;
+    long node_saving = 0;
+    const void* block = node->get_shared_parameters(size, node_saving);
+    if ( block == 0 )
+      continue;
+
+    const index m = node->get_model_id();
+    ++num_nodes[m];
+    block_size[m] = size;
+    saving[m] = node_saving;
+    blocks[m].insert(block);
+  }
+
+  DictionaryDatum info(new Dictionary);
+  for ( index m = 0; m < models_.size(); ++m )
+  {
+    if ( num_nodes[m] == 0 )
+      continue;
+
+    const long bytes = blocks[m].size() * block_size[m];
+    DictionaryDatum d(new Dictionary);
+    (*d)["nodes"] = num_nodes[m];
+    (*d)["blocks"] = blocks[m].size();
+    (*d)["bytes"] = bytes;
+    (*d)["saved"] = static_cast<long>(num_nodes[m]) * saving[m] - bytes;
+    (*info)[models_[m]->get_name()] = d;
+  }
+
+  return info;
+}
+
 void Network::print(index p, int depth)
 {
   Subnet *target = dynamic_cast<Subnet*>(get_node(p));
@@ -781,6 +883,7 @@ void Network::set_status_single_node_(Node& target, const DictionaryDatum& d, bo
     if ( clear_flags )
       d->clear_access_flags();
     target.set_status_base(d);
+    request_calibration(target);
     std::string missed;
     if ( !d->all_accessed(missed) )
     {
@@ -834,6 +937,17 @@ void Network::set_data_path_prefix_(const DictionaryDatum& d)
   }
 }
 
+DictionaryDatum Network::take_events(index idx)
+{
+  Node *target = get_node(idx);
+  assert(target != 0);
+
+  DictionaryDatum d(new Dictionary);
+  target->take_events(d);
+
+  return d;
+}
+
 DictionaryDatum Network::get_status(index idx) 
 {
   Node *target = get_node(idx);
@@ -1826,7 +1940,7 @@ int Network::execute_sli_protected(DictionaryDatum state, Name cmd)
   int result=i.execute_(exitlevel);
   i.DStack->pop();        // pop neuron's namespace
 
-  if (state->known("error"))
+  if (state->known(names::error))
   {
     assert(state->known(names::global_id));
     index g_id= (*state)[names::global_id];
@@ -1842,6 +1956,25 @@ int Network::execute_sli_protected(DictionaryDatum state, Name cmd)
   return result;
 }
 
+int Network::execute_sli_protected(DictionaryDatum state, Name cmd, const Token &proc)
+{
+  interpreter_.OStack.push(proc);
+  return execute_sli_protected(state, cmd);
+}
+
+Token Network::compile_sli_procedure(DictionaryDatum state, Name name)
+{
+  const ProcedureDatum *proc=dynamic_cast<ProcedureDatum *>(state->lookup(name).datum());
+  if (proc == 0)
+    return Token();
+
+  interpreter_.DStack->push(state);
+  Token code=compile_procedure(&interpreter_, *proc);
+  interpreter_.DStack->pop();
+
+  return code;
+}
+
 #ifdef HAVE_MUSIC
 void Network::register_music_in_port(std::string portname)
 {
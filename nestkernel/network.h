@@ -104,6 +104,7 @@ Description:
 Parameters:
   The following parameters can be set in the status dictionary.
 
+  calibrated_nodes         integertype - The number of nodes calibrated before the last simulation
   communicate_allgather    booltype    - Whether to use MPI_Allgather for communication (otherwise use CPEX)
   data_path                stringtype  - A path, where all data is written to (default is the current directory)
   data_prefix              stringtype  - A common prefix for all data files
@@ -399,11 +400,66 @@ SeeAlso: Simulate, Node
      */
     void resume();
 
+    /**
+     * Prepare the network for a sequence of calls to run().
+     * @see Scheduler::prepare()
+     */
+    void prepare();
+
+    /**
+     * Simulate for the given time after prepare().
+     * @see Scheduler::run()
+     */
+    void run(Time const &);
+
+    /**
+     * Finish a sequence of calls to run().
+     * @see Scheduler::cleanup()
+     */
+    void cleanup();
+
+    /**
+     * Register an observer for the spikes of the local nodes.
+     * @see Scheduler::add_spike_observer()
+     */
+    void add_spike_observer(SpikeObserver *);
+
+    /**
+     * Unregister a spike observer.
+     */
+    void remove_spike_observer(SpikeObserver *);
+
+    /**
+     * Note that the node changed, so that it is calibrated before it
+     * is updated again.
+     * @see Scheduler::request_calibration()
+     */
+    void request_calibration(Node &);
+
     /** 
      * Terminate the simulation after the time-slice is finished.
      */
     void terminate();
 
+    /**
+     * Interrupt the running simulation after the time-slice is
+     * finished. May be called from any thread.
+     * @see Scheduler::interrupt()
+     */
+    void interrupt();
+
+    /**
+     * Discard an interrupt requested while no simulation was running.
+     * @see Scheduler::clear_interrupt()
+     */
+    void clear_interrupt();
+
+    /**
+     * Return the simulated and the requested time of the current
+     * call to Simulate in ms. May be called from any thread.
+     */
+    void get_simulation_progress(double_t &done, double_t &total) const;
+
     /**
      * Return true if NEST will be quit because of an error, false otherwise.
      */
@@ -417,6 +473,15 @@ SeeAlso: Simulate, Node
 
     void memory_info();
 
+    /**
+     * Return a dictionary with an entry for each model whose local nodes
+     * share their parameters (see SharedParameters). Each entry holds the
+     * number of local nodes (nodes), of distinct parameter blocks
+     * (blocks), the memory of these blocks (bytes) and the memory saved
+     * compared to one copy of the parameters per node (saved).
+     */
+    DictionaryDatum get_shared_parameter_info() const;
+
     void print(index, int);
 
     /**
@@ -630,11 +695,33 @@ SeeAlso: Simulate, Node
      */
     DictionaryDatum get_status(index);
 
+    /**
+     * Take recorded events from a recording device. Returns the events
+     * dictionary of the device and clears the data from the device.
+     * @throws nest::UnknownNode       Target does not exist in the network.
+     * @throws nest::RecorderExpected  Target is not a recording device.
+     */
+    DictionaryDatum take_events(index);
+
     /**
      * Execute a SLI command in the neuron's namespace.
      */
     int execute_sli_protected(DictionaryDatum, Name);
 
+    /**
+     * Execute a SLI command in the neuron's namespace, with the given
+     * procedure on the operand stack.
+     */
+    int execute_sli_protected(DictionaryDatum, Name, const Token &);
+
+    /**
+     * Compile a procedure of the neuron's status dictionary in the
+     * neuron's namespace. Returns an empty token if the entry is
+     * not a procedure.
+     * @see compile_procedure()
+     */
+    Token compile_sli_procedure(DictionaryDatum, Name);
+
     /**
      * Return a reference to the model dictionary.
      */
@@ -872,6 +959,46 @@ SeeAlso: Simulate, Node
     scheduler_.terminate();
   }
 
+  inline
+  void Network::add_spike_observer(SpikeObserver *observer)
+  {
+    scheduler_.add_spike_observer(observer);
+  }
+
+  inline
+  void Network::remove_spike_observer(SpikeObserver *observer)
+  {
+    scheduler_.remove_spike_observer(observer);
+  }
+
+  inline
+  void Network::request_calibration(Node &node)
+  {
+    node.set_calibrated(false);
+    scheduler_.request_calibration(node.get_thread());
+  }
+
+  inline
+  void Network::interrupt()
+  {
+    scheduler_.interrupt();
+  }
+
+  inline
+  void Network::clear_interrupt()
+  {
+    scheduler_.clear_interrupt();
+  }
+
+  inline
+  void Network::get_simulation_progress(double_t &done, double_t &total) const
+  {
+    delay done_steps, total_steps;
+    scheduler_.get_progress(done_steps, total_steps);
+    done = Time(Time::step(done_steps)).get_ms();
+    total = Time(Time::step(total_steps)).get_ms();
+  }
+
   inline
   bool Network::quit_by_error() const
   {    
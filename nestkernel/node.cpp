@@ -43,7 +43,8 @@ namespace nest {
        thread_(0),
        vp_(invalid_thread_),
        frozen_(false),
-       buffers_initialized_(false)
+       buffers_initialized_(false),
+       calibrated_(false)
   {
   }
 
@@ -56,7 +57,8 @@ namespace nest {
        thread_(n.thread_),
        vp_(n.vp_),
        frozen_(n.frozen_),
-       buffers_initialized_(false)  // copy must always initialized its own buffers
+       buffers_initialized_(false),  // copy must always initialized its own buffers
+       calibrated_(false)
   {
   }
 
@@ -163,6 +165,14 @@ namespace nest {
     updateValue<bool>(dict, names::frozen, frozen_);
   }
 
+  /**
+   * Default implementation of take_events() just throws RecorderExpected
+   */
+  void Node::take_events(DictionaryDatum&)
+  {
+    throw RecorderExpected();
+  }
+
   /**
    * Default implementation of check_connection just throws UnexpectedEvent
    */
@@ -270,12 +270,31 @@ namespace nest {
 
     /**
      * Re-calculate dependent parameters of the node.
-     * This function is called each time a simulation is begun/resumed.
+     * This function is called before a simulation is begun, if the
+     * parameters or connections of the node changed since it was last
+     * calibrated, or if calibrate_always() returns true.
      * It must re-calculate all internal Variables of the node required
      * for spike handling or updating the node. 
      * 
      */
     virtual void calibrate()=0;
+
+    /**
+     * Return true if calibrate() must be called before each simulation,
+     * not only after a change. By default this is the case for devices,
+     * which open files or compute their activity window from the
+     * network time in calibrate().
+     */
+    virtual bool calibrate_always() const;
+
+    /**
+     * Return the address of the parameter block the node shares with
+     * other nodes (see SharedParameters). Store the size of the block in
+     * bytes in size and the bytes the node saves by not holding its own
+     * copy of the parameters in saving. Nodes which do not share their
+     * parameters return 0. Used by MemoryInfo and SharedParameterInfo.
+     */
+    virtual const void* get_shared_parameters(size_t &size, long &saving) const;
   
     /**
      * Finalize node.
@@ -335,6 +354,17 @@ namespace nest {
     virtual 
     void get_status(DictionaryDatum&) const=0;
 
+    /**
+     * Move recorded events to the events dictionary and clear them.
+     * Only recording devices implement this read-and-clear access
+     * to their data, the default implementation throws.
+     * @param d Events dictionary.
+     * @throws RecorderExpected
+     * @ingroup status_interface
+     */
+    virtual
+    void take_events(DictionaryDatum&);
+
   public:
     /**
      * @defgroup event_interface Communication.
@@ -593,6 +623,11 @@ namespace nest {
 
      void set_buffers_initialized(bool initialized) { buffers_initialized_ = initialized; }
 
+     //! True if the node has been calibrated since it last changed.
+     bool calibrated() const { return calibrated_; }
+
+     void set_calibrated(bool calibrated) { calibrated_ = calibrated; }
+
   private:
 
     void  set_lid_(index);         //!< Set local id, relative to the parent subnet
@@ -696,6 +731,7 @@ namespace nest {
     thread   vp_;            //!< virtual process node is assigned to
     bool     frozen_;   //!< node shall not be updated if true
     bool     buffers_initialized_;   //!< Buffers have been initialized
+    bool     calibrated_;   //!< Node has been calibrated since it last changed
 
   protected:
     static Network* net_;    //!< Pointer to global network driver.
@@ -718,6 +754,18 @@ namespace nest {
   {
     return false;
   }
+
+  inline
+  bool Node::calibrate_always() const
+  {
+    return !has_proxies() || potential_global_receiver();
+  }
+
+  inline
+  const void* Node::get_shared_parameters(size_t &, long &) const
+  {
+    return 0;
+  }
   
   inline
   bool Node::local_receiver() const
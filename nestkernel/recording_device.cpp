@@ -95,14 +95,14 @@ void nest::RecordingDevice::Parameters_::get(const RecordingDevice& rd,
   (*d)[names::to_screen]= to_screen_;
   (*d)[names::to_memory]= to_memory_;
   (*d)[names::to_file]= to_file_;
-  if ( rd.mode_ == RecordingDevice::MULTIMETER )
+  if ( rd.mode_ == RecordingDevice::MULTIMETER || rd.mode_ == RecordingDevice::SPIKE_DETECTOR )
     (*d)[names::to_accumulator]= to_accumulator_;
 
   ArrayDatum ad;
   if ( to_file_   ) ad.push_back(LiteralDatum(names::file));
   if ( to_memory_ ) ad.push_back(LiteralDatum(names::memory));
   if ( to_screen_ ) ad.push_back(LiteralDatum(names::screen));
-  if ( rd.mode_ == RecordingDevice::MULTIMETER )
+  if ( rd.mode_ == RecordingDevice::MULTIMETER || rd.mode_ == RecordingDevice::SPIKE_DETECTOR )
     if ( to_accumulator_ ) ad.push_back(LiteralDatum(names::accumulator));
   (*d)[names::record_to] = ad;
 
@@ -167,7 +167,7 @@ void nest::RecordingDevice::Parameters_::set(const RecordingDevice& rd,
   rec_change = updateValue<bool>(d, names::to_screen, to_screen_) || rec_change;
   rec_change = updateValue<bool>(d, names::to_memory, to_memory_) || rec_change;
   rec_change = updateValue<bool>(d, names::to_file, to_file_)     || rec_change;
-  if ( rd.mode_ == RecordingDevice::MULTIMETER )
+  if ( rd.mode_ == RecordingDevice::MULTIMETER || rd.mode_ == RecordingDevice::SPIKE_DETECTOR )
     rec_change = updateValue<bool>(d, names::to_accumulator, to_accumulator_) || rec_change;
 
   const bool have_record_to = d->known(names::record_to);
@@ -185,12 +185,12 @@ void nest::RecordingDevice::Parameters_::set(const RecordingDevice& rd,
         to_memory_ = true;
       else if ( *t == LiteralDatum(names::screen) || *t == Token(names::screen.toString()) )
         to_screen_ = true;
-      else if ( rd.mode_ == RecordingDevice::MULTIMETER  &&
+      else if ( ( rd.mode_ == RecordingDevice::MULTIMETER || rd.mode_ == RecordingDevice::SPIKE_DETECTOR ) &&
                 ( *t == LiteralDatum(names::accumulator) || *t == Token(names::accumulator.toString()) ) )
         to_accumulator_ = true;
       else
       {
-        if ( rd.mode_ == RecordingDevice::MULTIMETER )
+        if ( rd.mode_ == RecordingDevice::MULTIMETER || rd.mode_ == RecordingDevice::SPIKE_DETECTOR )
           throw BadProperty("/to_record must be array, allowed entries: /file, /memory, /screen, /accumulator.");
         else
           throw BadProperty("/to_record must be array, allowed entries: /file, /memory, /screen.");
@@ -227,18 +227,25 @@ void nest::RecordingDevice::State_::get(DictionaryDatum& d, const Parameters_& p
   else
     dict = getValue<DictionaryDatum>(d, names::events);
 
+  get_events(dict, p);
+
+  (*d)[names::events] = dict;
+}
+
+void nest::RecordingDevice::State_::get_events(DictionaryDatum& dict, const Parameters_& p) const
+{
   if ( p.withgid_ )
   {
     assert(not p.to_accumulator_);
     initialize_property_intvector(dict, names::senders);
-    append_property(dict, names::senders, std::vector<long>(event_senders_));
+    append_property(dict, names::senders, event_senders_);
   }
 
   if ( p.withweight_ )
   {
     assert(not p.to_accumulator_);
     initialize_property_doublevector(dict, names::weights);
-    append_property(dict, names::weights, std::vector<double_t>(event_weights_));
+    append_property(dict, names::weights, event_weights_);
   }
 
   if ( p.withtime_ )
@@ -250,30 +257,73 @@ void nest::RecordingDevice::State_::get(DictionaryDatum& d, const Parameters_& p
       // time data only from one thread and ensure that time data from other threads
       // is either empty of identical to what is present.
       if ( not p.to_accumulator_ ) 
-	append_property(dict, names::times, std::vector<long>(event_times_steps_));
+	append_property(dict, names::times, event_times_steps_);
       else
-	provide_property(dict, names::times, std::vector<long>(event_times_steps_));
+	provide_property(dict, names::times, event_times_steps_);
 
       if ( p.precise_times_ )
       {
         initialize_property_doublevector(dict, names::offsets);
 	if ( not p.to_accumulator_ )
-	  append_property(dict, names::offsets, std::vector<double_t>(event_times_offsets_));
+	  append_property(dict, names::offsets, event_times_offsets_);
 	else
-	  provide_property(dict, names::offsets, std::vector<double_t>(event_times_offsets_));
+	  provide_property(dict, names::offsets, event_times_offsets_);
       }
     }
     else
     {
       initialize_property_doublevector(dict, names::times);
       if ( not p.to_accumulator_ )
-	append_property(dict, names::times, std::vector<double_t>(event_times_ms_));
+	append_property(dict, names::times, event_times_ms_);
       else
-	provide_property(dict, names::times, std::vector<double_t>(event_times_ms_));
+	provide_property(dict, names::times, event_times_ms_);
     }
   }
+}
 
-  (*d)[names::events] = dict;
+void nest::RecordingDevice::State_::take_events(DictionaryDatum& dict, const Parameters_& p)
+{
+  // accumulated data must be combined across threads, so it is copied
+  if ( p.to_accumulator_ )
+  {
+    get_events(dict, p);
+    clear_events();
+    return;
+  }
+
+  if ( p.withgid_ )
+  {
+    initialize_property_intvector(dict, names::senders);
+    move_property(dict, names::senders, event_senders_);
+  }
+
+  if ( p.withweight_ )
+  {
+    initialize_property_doublevector(dict, names::weights);
+    move_property(dict, names::weights, event_weights_);
+  }
+
+  if ( p.withtime_ )
+  {
+    if ( p.time_in_steps_ )
+    {
+      initialize_property_intvector(dict, names::times);
+      move_property(dict, names::times, event_times_steps_);
+
+      if ( p.precise_times_ )
+      {
+        initialize_property_doublevector(dict, names::offsets);
+        move_property(dict, names::offsets, event_times_offsets_);
+      }
+    }
+    else
+    {
+      initialize_property_doublevector(dict, names::times);
+      move_property(dict, names::times, event_times_ms_);
+    }
+  }
+
+  clear_events();
 }
 
 void nest::RecordingDevice::State_::set(const DictionaryDatum& d)
@@ -508,6 +558,11 @@ void nest::RecordingDevice::set_status(const DictionaryDatum &d)
 }
 
 
+void nest::RecordingDevice::take_events(DictionaryDatum &d)
+{
+  S_.take_events(d, P_);
+}
+
 void nest::RecordingDevice::record_event(const Event& event, bool endrecord)
 {
   ++S_.events_;
@@ -527,7 +582,7 @@ void nest::RecordingDevice::record_event(const Event& event, bool endrecord)
       std::cout << '\n';
   }
 
-  if ( P_.to_file_ )
+  if ( ascii_to_file_() )
   {
     print_id_(B_.fs_, sender);
     print_time_(B_.fs_, stamp, offset);
@@ -541,11 +596,28 @@ void nest::RecordingDevice::record_event(const Event& event, bool endrecord)
   }
 
   // storing data when recording to accumulator relies on the fact
-  // that multimeter will call us only once per accumulation step
-  if ( P_.to_memory_ || P_.to_accumulator_ )
+  // that multimeter will call us only once per accumulation step;
+  // spike_detector keeps its own statistics in accumulator mode
+  if ( P_.to_memory_ || ( P_.to_accumulator_ && mode_ == MULTIMETER ) )
       store_data_(sender, stamp, offset, weight);
 }
 
+void nest::RecordingDevice::write_to_file(const char* data, std::streamsize n)
+{
+  if ( !P_.to_file_ )
+    return;
+
+  assert(B_.fs_.is_open());
+  B_.fs_.write(data, n);
+  if ( P_.flush_records_ )
+    B_.fs_.flush();
+}
+
+bool nest::RecordingDevice::file_is_empty()
+{
+  return P_.to_file_ && B_.fs_.is_open() && B_.fs_.tellp() == std::streampos(0);
+}
+
 void nest::RecordingDevice::print_id_(std::ostream& os, index gid)
 {
   if ( P_.withgid_ )
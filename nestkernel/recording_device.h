@@ -151,7 +151,9 @@ namespace nest {
                      fixed format; affects file output only, not screen output (default: false)
     /precision     - number of digits to use in output of doubles to file (default: 3)
     /binary        - if set to true, data is written in binary mode to files instead of ASCII.
-                     This setting affects file output only, not screen output (default: false)
+                     This setting affects file output only, not screen output (default: false).
+                     Multimeters and spike detectors write their own binary formats in this
+                     case, see multimeter and spike_detector.
     /fbuffer_size  - the size of the buffer to use for writing to files. The default size is
                      determined by the implementation of the C++ standard library. To obtain an
                      unbuffered file stream, use a buffer size of 0.
@@ -202,7 +204,9 @@ namespace nest {
    *
    *  @todo Some aspects of RecordingDevice behavior depend on the type of device:
    *        Multimeter needs to have its data cleared on n_events==0 and provides
-   *        an accumulator mode which is administered by RecordingDevice. To tell
+   *        an accumulator mode which is administered by RecordingDevice. Spike
+   *        detector also provides an accumulator mode, but only the flag is
+   *        administered here; it collects its statistics itself. To tell
    *        recording device about this deviating behavior, we mark the type of
    *        "owning device" with an enum flag on construction. This is not very
    *        clean and should probably be solved by subclassing instead.
@@ -317,17 +321,64 @@ namespace nest {
      */
     template <typename DataT>
     void set_status(const DictionaryDatum &, DataT& t);
+
+    /**
+     * Move recorded events to the given events dictionary and clear them.
+     * This implements read-and-clear access to recorded data: in contrast
+     * to get_status(), recorded data is handed over to the dictionary 
+     * without copying if the dictionary does not yet contain data from 
+     * other threads. The event counter is reset as by setting /n_events 0.
+     * @see Node::take_events()
+     */
+    void take_events(DictionaryDatum &);
     
     bool to_screen() const { return P_.to_screen_; }
     bool to_file()   const { return P_.to_file_;   }
     bool to_memory() const { return P_.to_memory_; }
     bool to_accumulator() const { return P_.to_accumulator_; }
+    bool binary()    const { return P_.binary_;    }
+    bool precise_times() const { return P_.precise_times_; }
+
+    /**
+     * Write a block of raw bytes to the output file.
+     * Used by devices that write their own binary file format; the block
+     * is written only if recording to file.
+     */
+    void write_to_file(const char*, std::streamsize);
+
+    /**
+     * Return true if recording to a file to which nothing has been written yet.
+     * Devices writing their own binary format use this to decide whether
+     * a file header is required.
+     */
+    bool file_is_empty();
+
+    /**
+     * Append binary representation of a plain value to a byte buffer.
+     * Helper for devices writing their own binary file format.
+     */
+    template <typename T>
+    static void append_binary(std::vector<char>&, const T&);
+
+    /**
+     * Append binary representation of all elements of a vector of plain
+     * values to a byte buffer.
+     */
+    template <typename T>
+    static void append_binary(std::vector<char>&, const std::vector<T>&);
 
     inline
       void set_precise(bool use_precise, long precision);
 
   private:
 
+    /**
+     * Return true if events are to be written to file as ASCII text.
+     * Multimeters and spike detectors in binary mode write their own
+     * format via write_to_file() instead.
+     */
+    bool ascii_to_file_() const;
+
     /** 
      * Print the time-stamp according to the recorder's flags.
      *
@@ -433,6 +484,12 @@ namespace nest {
       void clear_events();   //!< clear all data
       void get(DictionaryDatum&, const Parameters_&) const;  //!< Store current values in dictionary
       void set(const DictionaryDatum&);                      //!< Get values from dictionary
+
+      //! Store recorded data in events dictionary
+      void get_events(DictionaryDatum&, const Parameters_&) const;
+
+      //! Move recorded data to events dictionary and clear all data
+      void take_events(DictionaryDatum&, const Parameters_&);
     };
 
     // ------------------------------------------------------------------
@@ -464,6 +521,29 @@ void RecordingDevice::get_status(DictionaryDatum &d) const
   (*d)[names::element_type] = LiteralDatum(names::recorder);
 }
 
+inline
+bool RecordingDevice::ascii_to_file_() const
+{
+  return P_.to_file_
+    && !( P_.binary_ && ( mode_ == MULTIMETER || mode_ == SPIKE_DETECTOR ) );
+}
+
+template <typename T>
+void RecordingDevice::append_binary(std::vector<char>& buf, const T& v)
+{
+  const char* const p = reinterpret_cast<const char*>(&v);
+  buf.insert(buf.end(), p, p + sizeof(T));
+}
+
+template <typename T>
+void RecordingDevice::append_binary(std::vector<char>& buf, const std::vector<T>& v)
+{
+  if ( v.empty() )
+    return;
+  const char* const p = reinterpret_cast<const char*>(&v[0]);
+  buf.insert(buf.end(), p, p + v.size() * sizeof(T));
+}
+
 inline
 void RecordingDevice::set_precise(bool use_precise, long precision)
 {
@@ -483,7 +563,7 @@ void RecordingDevice::print_value(const ValueT& value, bool endrecord)
       std::cout << '\n';
   }
 
-  if ( P_.to_file_ )
+  if ( ascii_to_file_() )
   {
     B_.fs_ << value << '\t';
     if ( endrecord )
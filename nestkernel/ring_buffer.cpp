@@ -45,6 +45,48 @@ void nest::RingBuffer::clear()
 
 
 
+nest::MultiChannelRingBuffer::MultiChannelRingBuffer()
+  : buffer_(),
+    num_channels_(0)
+{}
+
+void nest::MultiChannelRingBuffer::resize(const size_t num_channels)
+{
+  const size_t size = (Scheduler::get_min_delay()+Scheduler::get_max_delay())
+                      * num_channels;
+  if (buffer_.size() == size && num_channels_ == num_channels)
+    return;
+
+  const size_t num_lags = Scheduler::get_min_delay()+Scheduler::get_max_delay();
+  if (num_channels_ == 0 || buffer_.size() != num_lags * num_channels_)
+  {
+    // the number of lags changed, so the old content cannot be mapped
+    num_channels_ = num_channels;
+    buffer_.assign(size, 0.0);
+    return;
+  }
+
+  // only the number of channels changed: keep the values queued for the
+  // remaining channels, so that no spikes are lost between simulations
+  std::vector<double_t> buffer(size, 0.0);
+  const size_t n = std::min(num_channels_, num_channels);
+  for (size_t lag = 0; lag < num_lags; ++lag)
+    std::copy(buffer_.begin() + lag * num_channels_,
+              buffer_.begin() + lag * num_channels_ + n,
+              buffer.begin() + lag * num_channels);
+  buffer_.swap(buffer);
+  num_channels_ = num_channels;
+}
+
+void nest::MultiChannelRingBuffer::clear()
+{
+  resize();    // does nothing if size is fine
+  std::fill(buffer_.begin(), buffer_.end(), 0.0); // clear all elements
+}
+
+
+
+
 nest::MultRBuffer::MultRBuffer()
   : buffer_(0.0, Scheduler::get_min_delay()+Scheduler::get_max_delay())
 {}
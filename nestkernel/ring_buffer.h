@@ -23,7 +23,9 @@
 #ifndef RING_BUFFER_H
 #define RING_BUFFER_H
 #include <valarray>
+#include <vector>
 #include <list>
+#include <algorithm>
 #include "nest.h"
 #include "scheduler.h"
 #include "nest_time.h"
@@ -171,6 +173,157 @@ namespace nest
 
 
 
+  /**
+   * Ring buffer holding several input channels of a node in one block.
+   *
+   * Models with more than one synaptic input channel (excitatory and 
+   * inhibitory inputs, or one channel per receptor port) used to hold one
+   * RingBuffer per channel.  Each of these owns a separate heap block, so
+   * that spike delivery to a node touches as many distant cache lines
+   * as the node has channels.  MultiChannelRingBuffer stores the values of
+   * all channels for a given lag next to each other, i.e., the buffer is
+   * laid out as [lag][channel].  Reading out all channels for one lag is
+   * thus a single streaming access.
+   *
+   * @note The number of channels is set by resize(size_t) and kept by
+   *       resize() and clear().
+   */
+  class MultiChannelRingBuffer {
+  public:
+
+    MultiChannelRingBuffer();
+
+    /**
+     * Add a value to the ring buffer.
+     * @param  offs     Arrival time relative to beginning of slice.
+     * @param  channel  Input channel, 0 <= channel < num_channels().
+     * @param  double_t Value to add.
+     */
+    void add_value(const long_t offs, const size_t channel, const double_t);
+
+    /**
+     * Access values of all channels for one lag.
+     * The returned pointer points to num_channels() contiguous values. It
+     * remains valid until the buffer is resized.  Values must be reset
+     * with reset_values() after reading.
+     * @param  offs  Offset of element to read within slice.
+     * @returns pointer to the values of channel 0 ... num_channels()-1,
+     *          or 0 if the buffer has no channels
+     */
+    const double_t* get_values(const long_t offs) const;
+
+    /**
+     * Set values of all channels for one lag to zero.
+     * @param  offs  Offset of element to reset within slice.
+     */
+    void reset_values(const long_t offs);
+
+    /**
+     * Read one value from ring buffer and clear it.
+     * @param  offs     Offset of element to read within slice.
+     * @param  channel  Input channel to read from.
+     * @returns value
+     */
+    double_t get_value(const long_t offs, const size_t channel);
+
+    /**
+     * Initialize the buffer with noughts. 
+     * Also resizes the buffer if necessary.
+     */
+    void clear();
+
+    /**
+     * Resize the buffer according to min_delay, max_delay and 
+     * the number of channels.  New elements are filled with noughts.
+     * If only the number of channels changes, the values queued for the
+     * channels kept are preserved.  If the number of lags changes, the
+     * buffer is cleared, as RingBuffer::resize() does.
+     * @note resize() has no effect if the buffer has the correct size.
+     */
+    void resize(const size_t num_channels);
+
+    /**
+     * Resize the buffer keeping the number of channels.
+     */
+    void resize() { resize(num_channels_); }
+
+    /**
+     * Returns number of input channels.
+     */
+    size_t num_channels() const { return num_channels_; }
+
+    /**
+     * Returns buffer size, for memory measurement.
+     */
+    size_t size() const { return buffer_.size(); }
+
+  private:
+
+    //! Buffered data, laid out as [lag][channel]
+    std::vector<double_t> buffer_;
+
+    //! Number of input channels
+    size_t num_channels_;
+
+    /**
+     * Obtain index of first channel for a given lag.
+     * @param delay delivery delay for event
+     * @returns index to buffer element of channel 0 into which event 
+     * should be recorded.
+     */
+    size_t get_index_(const delay d) const;
+
+  };
+
+  inline
+  void MultiChannelRingBuffer::add_value(const long_t offs, const size_t channel,
+                                         const double_t v)
+  {
+    assert(channel < num_channels_);
+    buffer_[get_index_(offs) + channel] += v;
+  }
+
+  inline
+  const double_t* MultiChannelRingBuffer::get_values(const long_t offs) const
+  {
+    assert(0 <= offs);
+    assert((delay)offs < Scheduler::get_min_delay());
+    if ( num_channels_ == 0 )
+      return 0;
+    return &buffer_[get_index_(offs)];
+  }
+
+  inline
+  void MultiChannelRingBuffer::reset_values(const long_t offs)
+  {
+    const size_t idx = get_index_(offs);
+    std::fill(buffer_.begin() + idx, buffer_.begin() + idx + num_channels_, 0.0);
+  }
+
+  inline
+  double_t MultiChannelRingBuffer::get_value(const long_t offs, const size_t channel)
+  {
+    assert(0 <= offs);
+    assert((delay)offs < Scheduler::get_min_delay());
+    assert(channel < num_channels_);
+
+    const size_t idx = get_index_(offs) + channel;
+    const double_t val = buffer_[idx];
+    buffer_[idx] = 0.0;   // clear buffer after reading
+    return val;
+  }
+
+  inline
+  size_t MultiChannelRingBuffer::get_index_(const delay d) const
+  {
+    const long_t idx = Scheduler::get_modulo(d);
+    assert(0 <= idx);
+    assert((size_t)(idx + 1) * num_channels_ <= buffer_.size());
+    return idx * num_channels_;
+  }
+
+
+
   class MultRBuffer {
   public:
     
@@ -24,6 +24,7 @@
 #include <iostream>
 #include <sstream>
 #include <set>
+#include <algorithm>
 
 #include "config.h"
 #include "compose.hpp"
@@ -93,6 +94,7 @@ nest::Scheduler::Scheduler(Network &net)
           from_step_(0L),
           to_step_(0L),    // consistent with to_do_ == 0
           terminate_(false),
+          interrupt_(0),
           off_grid_spiking_(false),
           print_time_(false),
           rng_()
@@ -131,6 +133,12 @@ void nest::Scheduler::init_()
   assert(initialized_ == false);
 
   simulated_ = false;
+  prepared_ = false;
+  calibrate_all_ = true;
+  calibration_requested_.assign(n_threads_, 0);
+  prepared_min_delay_ = 0;
+  prepared_max_delay_ = 0;
+  num_calibrated_nodes_ = 0;
 
   // The following line is executed by all processes, no need to communicate
   // this change in delays.
@@ -293,6 +301,13 @@ void nest::Scheduler::simulate(Time const & t)
 {
   assert(initialized_);
 
+  if (prepared_)
+  {
+    net_->message(SLIInterpreter::M_ERROR, "Scheduler::simulate",
+                  "Simulate cannot be called between Prepare and Cleanup. Use Run instead.");
+    throw KernelException();
+  }
+
   t_real_ = 0;
   t_slice_begin_ = timeval();
   t_slice_end_ = timeval();
@@ -300,6 +315,90 @@ void nest::Scheduler::simulate(Time const & t)
   if (t == Time::ms(0.0))
     return;
 
+  check_simulation_time_(t);
+
+  to_do_ += t.get_steps();
+  to_do_total_ = to_do_;
+  
+  prepare_simulation();
+
+  init_update_steps_(t);
+
+  resume();
+
+  finalize_simulation();
+}
+
+void nest::Scheduler::prepare()
+{
+  assert(initialized_);
+
+  if (prepared_)
+  {
+    net_->message(SLIInterpreter::M_ERROR, "Scheduler::prepare",
+                  "Prepare has already been called. Call Cleanup first.");
+    throw KernelException();
+  }
+
+  prepare_simulation();
+  prepared_ = true;
+}
+
+void nest::Scheduler::run(Time const & t)
+{
+  assert(initialized_);
+
+  if (!prepared_)
+  {
+    net_->message(SLIInterpreter::M_ERROR, "Scheduler::run",
+                  "Run must be preceded by Prepare.");
+    throw KernelException();
+  }
+
+  t_real_ = 0;
+  t_slice_begin_ = timeval();
+  t_slice_end_ = timeval();
+
+  if (t == Time::ms(0.0))
+    return;
+
+  check_simulation_time_(t);
+
+  to_do_ += t.get_steps();
+  to_do_total_ = to_do_;
+
+  // Nodes and buffers only need to be prepared again if nodes were
+  // added or changed, or new connections changed the delay extrema.
+  update_delay_extrema_();
+  const bool calibration_requested =
+    std::find(calibration_requested_.begin(), calibration_requested_.end(), 1)
+      != calibration_requested_.end();
+  if ( net_->size() != nodes_vec_network_size_ || calibrate_all_ || calibration_requested
+       || min_delay_ != prepared_min_delay_ || max_delay_ != prepared_max_delay_ )
+    prepare_simulation();
+
+  init_update_steps_(t);
+
+  resume();
+}
+
+void nest::Scheduler::cleanup()
+{
+  assert(initialized_);
+
+  if (!prepared_)
+  {
+    net_->message(SLIInterpreter::M_ERROR, "Scheduler::cleanup",
+                  "Cleanup must be preceded by Prepare.");
+    throw KernelException();
+  }
+
+  prepared_ = false;
+  finalize_simulation();
+}
+
+void nest::Scheduler::check_simulation_time_(Time const & t) const
+{
   if (t < Time::step(1))
   {
     net_->message(
@@ -328,12 +427,10 @@ void nest::Scheduler::simulate(Time const & t)
     net_->message(SLIInterpreter::M_ERROR, "Scheduler::simulate", msg);
     throw KernelException();
   }
+}
 
-  to_do_ += t.get_steps();
-  to_do_total_ = to_do_;
-  
-  prepare_simulation();
-
+void nest::Scheduler::init_update_steps_(Time const & t)
+{
   // from_step_ is not touched here.  If we are at the beginning
   // of a simulation, it has been reset properly elsewhere.  If
   // a simulation was ended and is now continued, from_step_ will
@@ -356,17 +453,10 @@ void nest::Scheduler::simulate(Time const & t)
             "This may result in inconsistent results under the following conditions: (i) A network contains "
             "more than one source of randomness, e.g., two different poisson_generators, and (ii) Simulate "
             "is called repeatedly with simulation times that are not multiples of the minimal delay.");
-
-  resume();
-
-  finalize_simulation();
 }
 
 void nest::Scheduler::prepare_simulation()
 {
-  if ( to_do_ == 0 )
-    return;
-
   // find shortest and longest delay across all MPI processes
   // this call sets the member variables
   update_delay_extrema_();
@@ -431,6 +521,8 @@ void nest::Scheduler::resume()
 {
   assert(initialized_);
 
+  // interrupt_ is not cleared here, so that an interrupt requested
+  // while the simulation is prepared still takes effect
   terminate_ = false;
 
   if(to_do_ == 0)
@@ -461,6 +553,22 @@ void nest::Scheduler::resume()
 
   Communicator::synchronize();
 
+  // an interrupt only applies to the simulation during which it arrived
+  const bool interrupted = interrupt_ != 0;
+  interrupt_ = 0;
+
+  if (terminate_ && interrupted && SLIsignalflag == 0)
+  {
+    if (to_do_ > 0)
+    {
+      net_->message(SLIInterpreter::M_INFO, "Scheduler::resume",
+          "Simulation interrupted. Use 'ResumeSimulation' to resume.");
+      throw SimulationInterrupted();
+    }
+    // interrupted during the last slice, nothing left to resume
+    terminate_ = false;
+  }
+
   if (terminate_)
   {
     net_->message(SLIInterpreter::M_ERROR, "Scheduler::resume",
@@ -554,7 +662,23 @@ void nest::Scheduler::update()
 #pragma omp single
       {
         if (to_step_ == min_delay_) // gather only at end of slice
+        {
+          if (!spike_observers_.empty())
+          {
+            try
+            {
+              notify_spike_observers_();
+            }
+            catch ( std::exception &e )
+            {
+              exceptions_raised.at(t) = lockPTR<WrappedThreadException>(
+                                            new WrappedThreadException(e));
+              terminate_ = true;
+            }
+          }
+
           gather_events_();
+        }
 
         advance_time_();
 
@@ -565,6 +689,9 @@ void nest::Scheduler::update()
           terminate_ = true;
         }
 
+        if (interrupt_ != 0)
+          terminate_ = true;
+
         if (print_time_)
         {
           gettimeofday(&t_slice_end_, NULL);
@@ -595,11 +722,17 @@ void nest::Scheduler::prepare_nodes()
   /* We initialize the buffers of each node and calibrate it. */
 
   size_t num_active_nodes = 0;  // counts nodes that will be updated
+  size_t num_calibrated_nodes = 0;
+
+  // Nodes calibrate themselves from the delay extrema, so all need
+  // to be calibrated again if they changed.
+  if ( min_delay_ != prepared_min_delay_ || max_delay_ != prepared_max_delay_ )
+    calibrate_all_ = true;
 
   std::vector<lockPTR<WrappedThreadException> > exceptions_raised(net_->get_num_threads());
 
 #ifdef _OPENMP
-#pragma omp parallel reduction(+:num_active_nodes)
+#pragma omp parallel reduction(+:num_active_nodes,num_calibrated_nodes)
   {
     size_t t = net_->get_thread_id();
 #else
@@ -614,7 +747,8 @@ void nest::Scheduler::prepare_nodes()
       for ( std::vector<Node*>::iterator it = nodes_vec_[t].begin() ;
             it != nodes_vec_[t].end(); ++it )
       {
-        prepare_node_(*it);
+        if ( prepare_node_(*it) )
+          ++num_calibrated_nodes;
         if ( not (*it)->is_frozen() )
           ++num_active_nodes;
       }
@@ -634,6 +768,12 @@ void nest::Scheduler::prepare_nodes()
     if ( exceptions_raised.at(thr).valid() )
       throw WrappedThreadException(*(exceptions_raised.at(thr)));
 
+  calibrate_all_ = false;
+  std::fill(calibration_requested_.begin(), calibration_requested_.end(), 0);
+  prepared_min_delay_ = min_delay_;
+  prepared_max_delay_ = max_delay_;
+  num_calibrated_nodes_ = num_calibrated_nodes;
+
   net_->message(SLIInterpreter::M_INFO, "Scheduler::prepare_nodes",
 		        String::compose("Simulating %1 local node%2.", num_active_nodes,
 		        		        num_active_nodes == 1 ? "" : "s"));
@@ -761,6 +901,10 @@ void nest::Scheduler::set_status(DictionaryDatum const &d)
   // MH 08-04-14
   TimeConverter time_converter;
 
+  // Nodes may calibrate themselves from kernel properties, e.g. the
+  // resolution or the random number generators.
+  calibrate_all_ = true;
+
   double_t time;
   if (updateValue<double_t>(d, "time", time))
   {
@@ -1070,6 +1214,7 @@ void nest::Scheduler::get_status(DictionaryDatum &d) const
 
   def<double_t>(d, "time", get_time().get_ms());
   def<long>(d, "to_do", to_do_);
+  def<long>(d, "calibrated_nodes", num_calibrated_nodes_);
   def<bool>(d, "print_time", print_time_);
 
   def<double>(d, "tics_per_ms", Time::get_tics_per_ms());
@@ -1401,6 +1546,49 @@ void nest::Scheduler::deliver_events_(thread t)
   }
 }
 
+void nest::Scheduler::add_spike_observer(SpikeObserver *observer)
+{
+  if (std::find(spike_observers_.begin(), spike_observers_.end(), observer) == spike_observers_.end())
+    spike_observers_.push_back(observer);
+}
+
+void nest::Scheduler::remove_spike_observer(SpikeObserver *observer)
+{
+  spike_observers_.erase(std::remove(spike_observers_.begin(), spike_observers_.end(), observer),
+                         spike_observers_.end());
+}
+
+void nest::Scheduler::notify_spike_observers_()
+{
+  // The vectors are kept as members, so that their memory is reused
+  // in each slice.
+  observed_gids_.clear();
+  observed_times_.clear();
+
+  for (delay lag = 0; lag < min_delay_; ++lag)
+  {
+    // spikes are stamped with the end of the step, see Network::send()
+    const double_t t_spike = (clock_ + Time::step(lag + 1)).get_ms();
+
+    for (index t = 0; t < n_threads_; ++t)
+    {
+      const std::vector<uint_t> &gids = spike_register_[t][lag];
+      observed_gids_.insert(observed_gids_.end(), gids.begin(), gids.end());
+      observed_times_.resize(observed_gids_.size(), t_spike);
+
+      const std::vector<OffGridSpike> &offgrid = offgrid_spike_register_[t][lag];
+      for (std::vector<OffGridSpike>::const_iterator s = offgrid.begin(); s != offgrid.end(); ++s)
+      {
+        observed_gids_.push_back(s->get_gid());
+        observed_times_.push_back(t_spike - s->get_offset());
+      }
+    }
+  }
+
+  for (std::vector<SpikeObserver*>::iterator o = spike_observers_.begin(); o != spike_observers_.end(); ++o)
+    (*o)->handle_spikes(observed_gids_, observed_times_);
+}
+
 void nest::Scheduler::gather_events_()
 {
   collocate_buffers_();
@@ -1478,6 +1666,7 @@ void nest::Scheduler::set_num_threads(thread n_threads)
 {
   n_threads_ = n_threads;
   nodes_vec_.resize(n_threads_);
+  calibration_requested_.assign(n_threads_, 0);
 
 #ifdef _OPENMP
   omp_set_num_threads(n_threads_);
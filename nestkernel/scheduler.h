@@ -27,6 +27,7 @@
 #include <iostream>
 #include <iomanip>
 #include <limits>
+#include <csignal>
 #include <fstream>
 #include <sys/time.h>
 
@@ -38,6 +39,7 @@
 #include "randomgen.h"
 #include "lockptr.h"
 #include "communicator.h"
+#include "spike_observer.h"
 
 namespace nest
 {
@@ -96,6 +98,42 @@ namespace nest
     /** Resume simulation after an interrupt. */
     void resume();
 
+    /**
+     * Prepare the network for a sequence of calls to run().
+     * This does the preparation simulate() does before each
+     * simulation once, so that short simulation steps, e.g. in a
+     * closed loop with another program, are cheap. Must be followed by
+     * cleanup() when done.
+     */
+    void prepare();
+
+    /**
+     * Simulate for the given time, after prepare().
+     * Nodes are not prepared again, unless nodes were added or
+     * changed since the last preparation. Nodes are not
+     * finalized, so recording devices are flushed only by cleanup().
+     */
+    void run(Time const&);
+
+    /**
+     * Finish a sequence of calls to run(), started by prepare().
+     */
+    void cleanup();
+
+    /**
+     * Return true between prepare() and cleanup().
+     */
+    bool get_prepared() const;
+
+    /**
+     * Note that a node on thread t has changed and must be calibrated
+     * before it is updated again. The node itself is marked by
+     * Node::set_calibrated(). This lets run() prepare the nodes again.
+     * Each thread has its own flag, so that the threads may connect to
+     * their nodes in parallel.
+     */
+    void request_calibration(thread t);
+
     /** 
      * All steps that must be done before a simulation.
      */
@@ -108,6 +146,48 @@ namespace nest
 
     void terminate();
 
+    /**
+     * Stop the running simulation at the end of the current time
+     * slice. Unlike terminate(), this may be called from any thread
+     * while the simulation runs, e.g. from another Python thread while
+     * PyNEST simulates without holding the global interpreter lock.
+     * If steps remain, the simulation then throws SimulationInterrupted
+     * and can be continued with ResumeSimulation. An interrupt during the
+     * last time slice is ignored and the simulation finishes normally.
+     * The interrupt is cleared when the simulation ends.
+     */
+    void interrupt();
+
+    /**
+     * Discard an interrupt requested while no simulation was running.
+     * PyNEST calls this before it releases the global interpreter lock
+     * to simulate, so that interrupts from other threads after that
+     * point are not lost.
+     */
+    void clear_interrupt();
+
+    /**
+     * Return the number of steps simulated so far and the number of
+     * steps requested by the current call to Simulate. The values are
+     * updated at the end of each time slice and may be read from any
+     * thread.
+     */
+    void get_progress(delay &done, delay &total) const;
+
+    /**
+     * Register an observer, which is handed the spikes of the local
+     * nodes at the end of each time slice. The observer is not owned
+     * by the Scheduler and kept by reset().
+     * @see SpikeObserver
+     */
+    void add_spike_observer(SpikeObserver *);
+
+    /**
+     * Unregister an observer, which must then no longer be used by
+     * the Scheduler.
+     */
+    void remove_spike_observer(SpikeObserver *);
+
     /**
      * Add global id of event sender to the spike_register. 
      * An event sent through this method will remain in the queue until
@@ -355,6 +435,23 @@ namespace nest
     
     void advance_time_();
 
+    /**
+     * Throw if the simulation time t is invalid.
+     */
+    void check_simulation_time_(Time const& t) const;
+
+    /**
+     * Set the steps to update in the first time slice of a
+     * simulation for time t.
+     */
+    void init_update_steps_(Time const& t);
+
+    /**
+     * Hand the spikes registered during the current slice to the spike
+     * observers. Must be called before gather_events_().
+     */
+    void notify_spike_observers_();
+
     void print_progress_();
 
     /**
@@ -365,10 +462,11 @@ namespace nest
     void prepare_nodes();
 
     /**
-     * Initialized buffers, register in list of nodes to update/finalize.
+     * Initialize buffers and calibrate the node if needed.
+     * Return true if the node was calibrated.
      * @see prepare_nodes()
      */
-    void prepare_node_(Node *);
+    bool prepare_node_(Node *);
     
     /**
      * Invoke finalize() on nodes registered for finalization.
@@ -423,10 +521,21 @@ namespace nest
     long t_real_;           //!< Accumunated wall-clock time spent simulating (in us) 
     
     bool terminate_;        //!< Terminate on signal or error
+    volatile sig_atomic_t interrupt_; //!< Set by interrupt(), checked at the end of each time slice
     bool simulated_;        //!< indicates whether the network has already been simulated for some time
+    bool prepared_;         //!< true between prepare() and cleanup()
+    bool calibrate_all_;    //!< calibrate all nodes in the next call to prepare_nodes()
+    std::vector<int> calibration_requested_; //!< per thread, a node changed since the nodes were last prepared
+    delay prepared_min_delay_;  //!< min_delay_ when the nodes were last prepared
+    delay prepared_max_delay_;  //!< max_delay_ when the nodes were last prepared
+    size_t num_calibrated_nodes_; //!< number of nodes calibrated when the nodes were last prepared
     bool off_grid_spiking_; //!< indicates whether spikes are not constrained to the grid 
     bool print_time_;       //!< Indicates whether time should be printed during simulations (or not)
 
+    std::vector<SpikeObserver*> spike_observers_; //!< Observers for the spikes of local nodes
+    std::vector<index> observed_gids_;     //!< Spikes of the current slice for spike_observers_
+    std::vector<double_t> observed_times_; //!< Spike times of the current slice for spike_observers_
+
     std::vector<long_t> rng_seeds_;  //!< The seeds of the local RNGs. These do not neccessarily describe the state of the RNGs.
     long_t grng_seed_;   //!< The seed of the global RNG, not neccessarily describing the state of the GRNG.
     
@@ -718,6 +827,19 @@ namespace nest
     return simulated_;
   }
 
+  inline
+  bool Scheduler::get_prepared() const
+  {
+    return prepared_;
+  }
+
+  inline
+  void Scheduler::request_calibration(thread t)
+  {
+    assert(static_cast<size_t>(t) < calibration_requested_.size());
+    calibration_requested_[t] = 1;
+  }
+
   inline
   void Scheduler::set_off_grid_communication(bool off_grid_spiking)
   {
@@ -750,12 +872,18 @@ namespace nest
   }
 
   inline
-  void Scheduler::prepare_node_(Node *n)
+  bool Scheduler::prepare_node_(Node *n)
   {
     // Frozen nodes are initialized and calibrated, so that they
     // have ring buffers and can accept incoming spikes.
     n->init_buffers();
+
+    if ( n->calibrated() && !calibrate_all_ && !n->calibrate_always() )
+      return false;
+
     n->calibrate();
+    n->set_calibrated(true);
+    return true;
   }
 
   inline
@@ -825,6 +953,25 @@ namespace nest
     terminate_=true;
   }
 
+  inline
+  void Scheduler::interrupt()
+  {
+    interrupt_ = 1;
+  }
+
+  inline
+  void Scheduler::clear_interrupt()
+  {
+    interrupt_ = 0;
+  }
+
+  inline
+  void Scheduler::get_progress(delay &done, delay &total) const
+  {
+    total = to_do_total_;
+    done = to_do_total_ - to_do_;
+  }
+
 }
 
 #endif //SCHEDULER_H
@@ -0,0 +1,111 @@
+/*
+ *  shared_parameters.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SHARED_PARAMETERS_H
+#define SHARED_PARAMETERS_H
+
+#include <cstddef>
+
+#include "lockptr.h"
+
+namespace nest {
+
+  /**
+   * Handle to a parameter block which is shared by all nodes with the
+   * same parameters.
+   *
+   * Nodes are created as copies of their model's prototype, so all
+   * nodes created from a model share the prototype's block until their
+   * parameters are changed. set() copies the block on write if it is
+   * shared, so changing the parameters of one node (or the defaults of
+   * the model) never changes those of other nodes. Setting the values
+   * the block already has keeps it shared.
+   *
+   * P must be copyable and provide operator==. The pointer to the block
+   * is kept next to the reference-counted handle, so reading parameters
+   * in update() costs a single indirection.
+   *
+   * Handles must not be copied concurrently unless NEST is configured
+   * with --enable-atomic-refcount. Nodes are created and destroyed
+   * outside of parallel regions, so this holds for handles in nodes.
+   */
+  template <class P>
+  class SharedParameters
+  {
+  public:
+    SharedParameters()
+      : block_(new P),
+        p_(&*block_)
+    {}
+
+    SharedParameters(const SharedParameters &sp)
+      : block_(sp.block_),
+        p_(sp.p_)
+    {}
+
+    SharedParameters& operator=(const SharedParameters &sp)
+    {
+      block_ = sp.block_;
+      p_ = sp.p_;
+      return *this;
+    }
+
+    const P& operator*() const { return *p_; }
+    const P* operator->() const { return p_; }
+
+    /**
+     * Replace the parameters by p. A shared block is copied if p differs
+     * from it, a block used by this handle only is overwritten.
+     */
+    void set(const P &p)
+    {
+      if ( block_.references() > 1 )
+      {
+        if ( p == *p_ )
+          return;
+        block_ = lockPTR<P>(new P(p));
+        p_ = &*block_;
+      }
+      else
+        *block_ = p;
+    }
+
+    /** Address of the parameter block, identical for all handles sharing it. */
+    const void* id() const { return p_; }
+
+    /** Size of a parameter block and its reference counter in bytes. */
+    static size_t block_size() { return sizeof(P) + lockPTR<P>::counter_size(); }
+
+    /**
+     * Bytes a node saves by holding a handle instead of its own copy
+     * of the parameters, not counting the blocks.
+     */
+    static long handle_saving() { return static_cast<long>(sizeof(P)) - static_cast<long>(sizeof(SharedParameters)); }
+
+  private:
+    lockPTR<P> block_;  //!< Parameter block, possibly shared
+    const P* p_;        //!< Cached pointer to the block
+  };
+
+}
+
+#endif
@@ -0,0 +1,94 @@
+/*
+ *  spike_observer.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SPIKE_OBSERVER_H
+#define SPIKE_OBSERVER_H
+
+#include <vector>
+
+#include "nest.h"
+
+namespace nest {
+
+  /**
+   * Interface for code that needs the spikes of the local nodes as
+   * soon as they are emitted, without a spike_detector in between,
+   * e.g. to close a loop between NEST and an external program.
+   *
+   * Observers are registered with Network::add_spike_observer(). At
+   * the end of each time slice, the Scheduler hands them the spikes of
+   * all local nodes that send spikes to other nodes (i.e. neurons, not
+   * devices) emitted during the slice. Spikes of a slice which is
+   * only partly simulated are handed over when the slice is completed
+   * by the next call to Simulate or Run.
+   *
+   * handle_spikes() is called from within the parallel update, by a
+   * single thread while all other threads wait. It must not call back
+   * into the network.
+   */
+  class SpikeObserver
+  {
+  public:
+    virtual ~SpikeObserver() {}
+
+    /**
+     * Handle the spikes of one time slice. gids[i] spiked at times[i]
+     * (in ms), spikes are ordered by time.
+     */
+    virtual void handle_spikes(const std::vector<index> &gids,
+                               const std::vector<double_t> &times) = 0;
+  };
+
+  /**
+   * Spike observer which collects the spikes in memory, until they
+   * are taken with swap().
+   */
+  class SpikeBuffer : public SpikeObserver
+  {
+  public:
+    void handle_spikes(const std::vector<index> &gids,
+                       const std::vector<double_t> &times)
+    {
+      gids_.insert(gids_.end(), gids.begin(), gids.end());
+      times_.insert(times_.end(), times.begin(), times.end());
+    }
+
+    size_t size() const { return gids_.size(); }
+
+    /**
+     * Exchange the collected spikes with the given vectors. Passing
+     * empty vectors empties the buffer.
+     */
+    void swap(std::vector<index> &gids, std::vector<double_t> &times)
+    {
+      gids_.swap(gids);
+      times_.swap(times);
+    }
+
+  private:
+    std::vector<index> gids_;
+    std::vector<double_t> times_;
+  };
+
+}
+
+#endif
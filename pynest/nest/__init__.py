@@ -62,6 +62,8 @@ hl_api.spp = sli_pop
 
 hl_api.pcd = engine.push_connection_datums
 
+hl_api.engine = engine
+
 initialized = False
 
 def catching_sli_run(cmd):
@@ -72,13 +74,14 @@ def catching_sli_run(cmd):
     executed.
     """
 
-    engine.run('{%s} runprotected' % cmd)
-    if not sli_pop():
-        errorname = sli_pop()
-        message = sli_pop()
-        commandname = sli_pop()
-        engine.run('clear')
-        raise hl_api.NESTError("{0} in {1}{2}".format(errorname, commandname, message))
+    with engine._lock:
+        engine.run('{%s} runprotected' % cmd)
+        if not sli_pop():
+            errorname = sli_pop()
+            message = sli_pop()
+            commandname = sli_pop()
+            engine.run('clear')
+            raise hl_api.NESTError("{0} in {1}{2}".format(errorname, commandname, message))
 
 
 sli_run = catching_sli_run
@@ -114,10 +117,11 @@ def sli_func(s, *args, **kwargs):
     elif len(kwargs) > 0:
         hl_api.NESTError("'namespace' and 'litconv' are the only valid keyword arguments.")
     
-    sli_push(args)       # push array of arguments on SLI stack
-    sli_push(s)          # push command string
-    sli_run(slifun)      # SLI support code to execute s on args
-    r = sli_pop()        # return value is an array
+    with engine._lock:
+        sli_push(args)       # push array of arguments on SLI stack
+        sli_push(s)          # push command string
+        sli_run(slifun)      # SLI support code to execute s on args
+        r = sli_pop()        # return value is an array
 
     if len(r) == 1:      # 1 return value is no tuple
         return r[0]
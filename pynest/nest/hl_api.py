@@ -60,7 +60,7 @@ from .pynestkernel import SLIDatum, SLILiteral, NESTError, CONN_LEN
 
 # These variables MUST be set by __init__.py right after importing.
 # There is no safety net, whatsoever.
-sps = spp = sr = pcd = None
+sps = spp = sr = pcd = engine = None
 
 __debug = False
 
@@ -166,15 +166,34 @@ def stack_checker(f):
     return stack_checker_func
 
 
+def engine_locker(f):
+    """
+    Decorator to hold the engine lock while a function runs, so that
+    its calls of sps(), sr() and spp() are not interleaved with those
+    of other threads. The lock is reentrant, so decorated functions
+    may call each other.
+    """
+
+    @functools.wraps(f)
+    def engine_locker_func(*args, **kwargs):
+        with engine._lock:
+            return f(*args, **kwargs)
+
+    return engine_locker_func
+
+
 def check_stack(thing):
     """
     Convenience wrapper for applying the stack_checker decorator to
     all class methods of the given class, or to a given function. If
     the object cannot be decorated, it is returned unchanged.
+    Functions also hold the engine lock for the whole call, see
+    engine_locker(). Class methods do not, so that test methods can
+    wait for other threads that call NEST.
     """
 
     if inspect.isfunction(thing):
-        return stack_checker(thing)
+        return engine_locker(stack_checker(thing))
     elif inspect.isclass(thing):
         for name, mtd in inspect.getmembers(thing, predicate=inspect.ismethod):
             if name.startswith("test_"):
@@ -232,6 +251,20 @@ def is_sequence_of_gids(seq):
     return all(isinstance(n, int) and n >= 0 for n in seq)
 
 
+def is_gid_array(seq):
+    """
+    Checks whether the argument is a sequence of GIDs or a
+    one-dimensional NumPy array of integers, which the kernel can use
+    directly
+    """
+
+    if is_coercible_to_sli_array(seq):
+        return is_sequence_of_gids(seq)
+
+    dtype = getattr(seq, 'dtype', None)
+    return dtype is not None and dtype.kind in 'iu' and seq.ndim == 1
+
+
 def broadcast(item, length, allowed_types, name="item"):
 
     if isinstance(item, allowed_types):
@@ -355,10 +388,37 @@ def message(level,sender,text):
 def Simulate(t):
     """
     Simulate the network for t milliseconds.
+
+    The kernel does not hold the Python GIL while it simulates, so
+    other Python threads keep running. They can follow the simulation
+    with GetSimulationProgress() and stop it with
+    InterruptSimulation(). Other NEST functions called from these
+    threads wait until Simulate() has returned.
+    """
+
+    engine.simulate(float(t))
+
+
+def InterruptSimulation():
+    """
+    Stop the running simulation at the end of the current time slice.
+    Simulate() then raises a NESTError (SimulationInterrupted), and
+    the simulation can be continued with ResumeSimulation(). This
+    function may be called from any thread while another thread
+    simulates. It has no effect if no simulation is running.
+    """
+
+    engine.interrupt()
+
+
+def GetSimulationProgress():
+    """
+    Return the simulated time and the requested time in ms of the
+    current call to Simulate(). This function may be called from any
+    thread while another thread simulates.
     """
 
-    sps(float(t))
-    sr('ms Simulate')
+    return engine.get_simulation_progress()
 
 
 @check_stack
@@ -370,6 +430,72 @@ def ResumeSimulation():
     sr("ResumeSimulation")
 
 
+@check_stack
+def Prepare():
+    """
+    Prepare the network for a sequence of calls to Run().
+
+    Simulate() prepares and calibrates all nodes before, and finalizes
+    them after each call, which makes short simulation steps
+    expensive. With Prepare() this is done once for all following
+    calls to Run(), until Cleanup() is called. Run() prepares the
+    network again only if nodes were created or changed, e.g. by
+    SetStatus() or Connect().
+    """
+
+    sr("Prepare")
+
+
+def Run(t):
+    """
+    Simulate the network for t milliseconds after Prepare().
+    Recording devices write their data to file only at Cleanup().
+    """
+
+    engine.run_prepared(float(t))
+
+
+@check_stack
+def Cleanup():
+    """
+    End a sequence of calls to Run() started by Prepare().
+    """
+
+    sr("Cleanup")
+
+
+class RunManager(object):
+    """
+    Context manager, which calls Prepare() on entry and Cleanup() on
+    exit, e.g.
+
+    with nest.RunManager():
+        for i in range(1000):
+            nest.Run(1.0)
+    """
+
+    def __enter__(self):
+        Prepare()
+
+    def __exit__(self, exc_type, exc_val, exc_tb):
+        Cleanup()
+
+
+def SetSpikeCallback(callback):
+    """
+    Hand the spikes of the local neurons to callback(gids, times)
+    after each call to Simulate() or Run(), without recording them
+    with a spike_detector. gids and times are arrays ordered by spike
+    time, holding the spikes emitted since the previous call. Spikes
+    of a time slice are collected at its end, so with a step shorter
+    than the minimal delay, the spikes of the current slice are
+    handed over when the slice is completed. None removes the
+    callback. The callback stays registered across ResetKernel().
+    """
+
+    engine.set_spike_callback(callback)
+
+
 @check_stack
 def ResetKernel():
     """
@@ -602,16 +728,20 @@ def Create(model, n=1, params=None):
     with size n). If omitted, the model's defaults are used.
     """
 
-    if isinstance(params, dict):
-        cmd = "/%s 3 1 roll exch Create" % model
-        sps(params)
-    else:
-        cmd = "/%s exch Create" % model
+    if isinstance(params, dict) or not isinstance(n, int):
+        if isinstance(params, dict):
+            cmd = "/%s 3 1 roll exch Create" % model
+            sps(params)
+        else:
+            cmd = "/%s exch Create" % model
 
-    sps(n)
-    sr(cmd)
+        sps(n)
+        sr(cmd)
+
+        last_gid = spp()
+    else:
+        last_gid = engine.create(model, n)
 
-    last_gid = spp()
     gids = tuple(range(last_gid - n + 1, last_gid + 1))
 
     if params is not None and not isinstance(params, dict):
@@ -647,6 +777,25 @@ def SetStatus(nodes, params, val=None):
     if len(nodes) == 0:
         return
 
+    if is_sequence_of_gids(nodes):
+        # nodes are set directly in the kernel
+        if val is not None and is_literal(params):
+            if is_iterable(val) and not isinstance(val, (uni_str, dict)):
+                if len(val) == len(nodes):
+                    engine.set_status_values(nodes, params, val)
+                    return
+                params = [{params: x} for x in val]
+            else:
+                params = {params: val}
+
+        if not isinstance(params, dict):
+            params = broadcast(params, len(nodes), (dict,), "params")
+            if len(nodes) != len(params):
+                raise TypeError("status dict must be a dict, or list of dicts of length 1 or len(nodes)")
+
+        engine.set_status(nodes, params)
+        return
+
     if val is not None and is_literal(params):
         if is_iterable(val) and not isinstance(val, (uni_str, dict)):
             params = [{params: x} for x in val]
@@ -683,6 +832,10 @@ def GetStatus(nodes, keys=None):
     if len(nodes) == 0:
         return nodes
 
+    if is_sequence_of_gids(nodes):
+        if keys is None or is_literal(keys) or is_iterable(keys):
+            return engine.get_status(nodes, keys)
+
     if keys is None:
         cmd = '{ GetStatus } Map'
     elif is_literal(keys):
@@ -703,6 +856,54 @@ def GetStatus(nodes, keys=None):
     return spp()
 
 
+@check_stack
+def GetEvents(nodes, clear=False):
+    """
+    Return a list with the events dictionaries of the given recording
+    devices. Event data is returned as read-only NumPy arrays that use
+    the memory of the data passed from the kernel without copying it;
+    use copy() to obtain arrays that can be modified. If clear is
+    True, the events are removed from the devices, as by setting
+    n_events to 0, and recorded data is handed over without copying in
+    the kernel as well. This allows long simulations to collect data
+    incrementally between calls to Simulate.
+    """
+
+    if not is_coercible_to_sli_array(nodes):
+        raise TypeError("nodes must be a list of nodes")
+
+    if len(nodes) == 0:
+        return nodes
+
+    if clear:
+        cmd = '{ TakeEvents } Map'
+    else:
+        cmd = '{ GetStatus /events get } Map'
+
+    sps(nodes)
+    sr(cmd)
+
+    return spp()
+
+
+@check_stack
+def SetSpikeTrains(gids, times):
+    """
+    Set the spike times of many spike generators at once. gids and
+    times must have the same length, with one entry per spike: the
+    spike generator gids[i] emits a spike at times[i]. The spike times
+    of each generator must be sorted, and spike weights are cleared.
+    Passing NumPy arrays avoids converting the data element by element.
+    """
+
+    if len(gids) != len(times):
+        raise NESTError("gids and times must have the same length.")
+
+    sps(gids)
+    sps(times)
+    sr('SetSpikeTrains')
+
+
 @check_stack
 def GetLID(gid) :
     """
@@ -1102,6 +1303,20 @@ def Connect(pre, post, conn_spec=None, syn_spec=None, model=None):
     if model is not None and syn_spec is not None:
         raise NESTError("'model' is an alias for 'syn_spec' and cannot be used together with 'syn_spec'.")
 
+    if model is not None:
+        syn_spec = model
+
+    if is_gid_array(pre) and is_gid_array(post) and \
+       isinstance(conn_spec, (type(None), uni_str, dict)) and \
+       isinstance(syn_spec, (type(None), uni_str, dict)):
+        # pre, post and the specifications are passed directly to the kernel
+        if is_string(conn_spec):
+            conn_spec = {'rule': conn_spec}
+        if is_string(syn_spec):
+            syn_spec = {'model': syn_spec}
+        engine.connect(pre, post, conn_spec, syn_spec)
+        return
+
     sps(pre)
     sps(post)
 
@@ -1112,9 +1327,6 @@ def Connect(pre, post, conn_spec=None, syn_spec=None, model=None):
     else:
         sr('/Connect /conn_spec GetOption')
 
-    if model is not None:
-        syn_spec = model
-
     if syn_spec is not None:
         sps(syn_spec)
         if is_string(syn_spec):
@@ -0,0 +1,322 @@
+# -*- coding: utf-8 -*-
+#
+# spike_file.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Functions for reading and merging binary spike files.
+
+Spike detectors with /to_file and /binary set write spikes in a
+chunked, columnar binary format, one file per virtual process (see
+the documentation of spike_detector for the layout). The files are
+accessed through memory mapping, and the chunk headers are used to
+skip all chunks that contain no spikes in the requested time window
+or from the requested GIDs, so that only the relevant part of a file
+is actually read from disk.
+"""
+
+import numpy
+
+_MAGIC = b'NESTSDF'
+_VERSION = 1
+_BYTE_ORDER_MARK = 0x01020304
+_N_CHUNK_HEADER = 6  # n, flags, t_min, t_max, gid_min, gid_max
+
+
+class SpikeFile(object):
+    """
+    Binary spike file written by a spike_detector.
+
+    The file is memory mapped on construction, and an index of all
+    chunks is built from the chunk headers. The index is available as
+    arrays in the attributes chunk_t_min, chunk_t_max (in steps),
+    chunk_gid_min, chunk_gid_max and chunk_n.
+    """
+
+    def __init__(self, filename):
+
+        self.filename = filename
+        self._data = numpy.memmap(filename, dtype=numpy.uint8, mode='r')
+
+        self._read_header()
+        self._build_index()
+
+    def _read_header(self):
+
+        data = self._data
+        if len(data) < 28 or data[:7].tobytes() != _MAGIC:
+            raise ValueError("%s is not a binary spike file." % self.filename)
+        if data[7] != _VERSION:
+            raise ValueError("%s: unsupported format version %d."
+                             % (self.filename, data[7]))
+
+        for order in ('<', '>'):
+            bom = numpy.frombuffer(data, dtype=order + 'u4', count=1, offset=8)[0]
+            if bom == _BYTE_ORDER_MARK:
+                break
+        else:
+            raise ValueError("%s: invalid byte order mark." % self.filename)
+
+        size_long, size_double = numpy.frombuffer(data, dtype=order + 'u4',
+                                                  count=2, offset=12)
+        if size_double != 8:
+            raise ValueError("%s: unsupported size of double." % self.filename)
+
+        self.long_type = numpy.dtype(order + 'i%d' % size_long)
+        self.double_type = numpy.dtype(order + 'f8')
+        self.resolution = numpy.frombuffer(data, dtype=self.double_type,
+                                           count=1, offset=20)[0]
+        self._header_size = 28
+
+    def _build_index(self):
+
+        data = self._data
+        sl = self.long_type.itemsize
+        offset = self._header_size
+        index = []
+
+        while offset + _N_CHUNK_HEADER * sl <= len(data):
+            head = numpy.frombuffer(data, dtype=self.long_type,
+                                    count=_N_CHUNK_HEADER, offset=offset)
+            n, flags = head[0], head[1]
+            size = _N_CHUNK_HEADER * sl + n * 2 * sl
+            if flags & 1:
+                size += n * self.double_type.itemsize
+
+            # ignore incomplete chunk at end of file, e.g., after a crash
+            if offset + size > len(data):
+                break
+
+            index.append((offset,) + tuple(head))
+            offset += size
+
+        index = numpy.array(index, dtype=numpy.int64).reshape(-1, 7)
+        self._chunk_offset = index[:, 0]
+        self.chunk_n = index[:, 1]
+        self._chunk_flags = index[:, 2]
+        self.chunk_t_min = index[:, 3]
+        self.chunk_t_max = index[:, 4]
+        self.chunk_gid_min = index[:, 5]
+        self.chunk_gid_max = index[:, 6]
+
+    def __len__(self):
+
+        return int(self.chunk_n.sum())
+
+    def _chunk(self, c):
+        """Return (senders, steps, offsets) of chunk c, offsets may be None."""
+
+        sl = self.long_type.itemsize
+        n = int(self.chunk_n[c])
+        offset = int(self._chunk_offset[c]) + _N_CHUNK_HEADER * sl
+
+        senders = numpy.frombuffer(self._data, dtype=self.long_type,
+                                   count=n, offset=offset)
+        steps = numpy.frombuffer(self._data, dtype=self.long_type,
+                                 count=n, offset=offset + n * sl)
+        offsets = None
+        if self._chunk_flags[c] & 1:
+            offsets = numpy.frombuffer(self._data, dtype=self.double_type,
+                                       count=n, offset=offset + 2 * n * sl)
+
+        return senders, steps, offsets
+
+    def select_chunks(self, t_min=None, t_max=None, gids=None):
+        """
+        Return indices of all chunks that may contain spikes with
+        t_min <= t < t_max (in ms) from any of the given GIDs.
+        """
+
+        sel = numpy.ones(len(self.chunk_n), dtype=bool)
+
+        # precise spike times lie within (step - 1, step] * resolution
+        if t_min is not None:
+            sel &= self.chunk_t_max * self.resolution >= t_min
+        if t_max is not None:
+            sel &= (self.chunk_t_min - 1) * self.resolution < t_max
+
+        if gids is not None:
+            gids = numpy.unique(numpy.asarray(gids, dtype=numpy.int64))
+            pos = numpy.searchsorted(gids, self.chunk_gid_min)
+            found = pos < len(gids)
+            sel &= found
+            sel[found] &= gids[pos[found]] <= self.chunk_gid_max[found]
+
+        return numpy.nonzero(sel)[0]
+
+    def read_raw(self, t_min=None, t_max=None, gids=None):
+        """
+        Return arrays (senders, steps, offsets) of all spikes with
+        t_min <= t < t_max (in ms) from the given GIDs, in file order.
+        Offsets are zero for chunks without precise spike times.
+        """
+
+        senders, steps, offsets = [], [], []
+        for c in self.select_chunks(t_min, t_max, gids):
+            s, st, o = self._chunk(c)
+            if o is None:
+                o = numpy.zeros(len(s))
+            senders.append(s)
+            steps.append(st)
+            offsets.append(o)
+
+        if not senders:
+            return (numpy.array([], dtype=numpy.int64),
+                    numpy.array([], dtype=numpy.int64),
+                    numpy.array([], dtype=numpy.float64))
+
+        senders = numpy.concatenate(senders).astype(numpy.int64)
+        steps = numpy.concatenate(steps).astype(numpy.int64)
+        offsets = numpy.concatenate(offsets).astype(numpy.float64)
+
+        sel = numpy.ones(len(senders), dtype=bool)
+        if t_min is not None or t_max is not None:
+            times = steps * self.resolution - offsets
+            if t_min is not None:
+                sel &= times >= t_min
+            if t_max is not None:
+                sel &= times < t_max
+        if gids is not None:
+            sel &= numpy.in1d(senders, gids)
+
+        return senders[sel], steps[sel], offsets[sel]
+
+    def read(self, t_min=None, t_max=None, gids=None):
+        """
+        Return dictionary with arrays 'senders' and 'times' (in ms) of
+        all spikes with t_min <= t < t_max from the given GIDs, in file
+        order. All arguments are optional.
+        """
+
+        senders, steps, offsets = self.read_raw(t_min, t_max, gids)
+        return {'senders': senders,
+                'times': steps * self.resolution - offsets}
+
+
+def read_spike_files(filenames, t_min=None, t_max=None, gids=None):
+    """
+    Read spikes with t_min <= t < t_max (in ms) from the given GIDs
+    from several binary spike files, e.g., the files written by one
+    spike_detector on all virtual processes. Returns a dictionary with
+    arrays 'senders' and 'times', sorted by time and, for equal times,
+    by sender.
+    """
+
+    senders, times = [], []
+    for f in filenames:
+        events = SpikeFile(f).read(t_min, t_max, gids)
+        senders.append(events['senders'])
+        times.append(events['times'])
+
+    senders = numpy.concatenate(senders)
+    times = numpy.concatenate(times)
+    order = numpy.lexsort((senders, times))
+
+    return {'senders': senders[order], 'times': times[order]}
+
+
+def _write_chunk(f, senders, steps, offsets, with_offsets, long_type):
+
+    head = numpy.array([len(senders), 1 if with_offsets else 0,
+                        steps.min(), steps.max(),
+                        senders.min(), senders.max()], dtype=long_type)
+    f.write(head.tobytes())
+    f.write(senders.astype(long_type).tobytes())
+    f.write(steps.astype(long_type).tobytes())
+    if with_offsets:
+        f.write(offsets.astype(long_type.byteorder + 'f8').tobytes())
+
+
+def merge_spike_files(filenames, outname, chunk_size=65536):
+    """
+    Merge several binary spike files, e.g., the files written by one
+    spike_detector on all virtual processes, into a single binary spike
+    file outname, in which spikes are sorted by time and, for equal
+    times, by sender.
+
+    The files are merged window by window in time, so that only about
+    chunk_size spikes need to be held in memory at any time, provided
+    the chunks of the input files are approximately in time order, as
+    written by spike_detector.
+    """
+
+    files = [SpikeFile(f) for f in filenames]
+    if not files:
+        raise ValueError("No files to merge.")
+
+    resolution = files[0].resolution
+    long_type = files[0].long_type
+    for sf in files:
+        if sf.resolution != resolution:
+            raise ValueError("Cannot merge files with different resolutions.")
+
+    n_total = sum(len(sf) for sf in files)
+    with_offsets = any((sf._chunk_flags & 1).any() for sf in files)
+
+    with open(outname, 'wb') as f:
+
+        f.write(numpy.frombuffer(_MAGIC + bytes(bytearray([_VERSION])),
+                                 dtype=numpy.uint8).tobytes())
+        f.write(numpy.array([_BYTE_ORDER_MARK, long_type.itemsize, 8],
+                            dtype=long_type.byteorder + 'u4').tobytes())
+        f.write(numpy.array([resolution],
+                            dtype=long_type.byteorder + 'f8').tobytes())
+
+        if n_total == 0:
+            return
+
+        t_first = min(sf.chunk_t_min.min() for sf in files if len(sf))
+        t_last = max(sf.chunk_t_max.max() for sf in files if len(sf))
+
+        # windows in steps, sized to hold about chunk_size spikes on average
+        n_windows = max(1, n_total // chunk_size)
+        window = max(1, (t_last - t_first + 1) // n_windows + 1)
+
+        for w_begin in range(t_first, t_last + 1, window):
+            w_end = w_begin + window
+            senders, steps, offsets = [], [], []
+            for sf in files:
+                sel = numpy.nonzero((sf.chunk_t_max >= w_begin) &
+                                    (sf.chunk_t_min < w_end))[0]
+                for c in sel:
+                    s, st, o = sf._chunk(c)
+                    in_window = (st >= w_begin) & (st < w_end)
+                    senders.append(s[in_window].astype(numpy.int64))
+                    steps.append(st[in_window].astype(numpy.int64))
+                    offsets.append(numpy.zeros(in_window.sum())
+                                   if o is None else o[in_window])
+
+            if not senders:
+                continue
+
+            senders = numpy.concatenate(senders)
+            steps = numpy.concatenate(steps)
+            offsets = numpy.concatenate(offsets)
+            if len(senders) == 0:
+                continue
+
+            # larger offsets mean earlier spikes within a step
+            order = numpy.lexsort((senders, -offsets, steps))
+            senders, steps, offsets = (senders[order], steps[order],
+                                       offsets[order])
+
+            for b in range(0, len(senders), chunk_size):
+                e = b + chunk_size
+                _write_chunk(f, senders[b:e], steps[b:e], offsets[b:e],
+                             with_offsets, long_type)
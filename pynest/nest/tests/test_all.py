@@ -28,6 +28,9 @@ from . import test_errors
 from . import test_stack
 from . import test_create
 from . import test_status
+from . import test_direct_api
+from . import test_simulation_control
+from . import test_prepare_run_cleanup
 from . import test_onetooneconnect
 from . import test_convergent_divergent_connect
 from . import test_connect_all_to_all
@@ -40,6 +43,7 @@ from . import test_findconnections
 from . import test_getconnections
 from . import test_dataconnect
 from . import test_events
+from . import test_spike_file
 from . import test_networks
 from . import test_threads
 from . import test_csa
@@ -54,6 +58,9 @@ def suite():
     suite.addTest(test_stack.suite())
     suite.addTest(test_create.suite())                    
     suite.addTest(test_status.suite())
+    suite.addTest(test_direct_api.suite())
+    suite.addTest(test_simulation_control.suite())
+    suite.addTest(test_prepare_run_cleanup.suite())
     suite.addTest(test_onetooneconnect.suite())
     suite.addTest(test_convergent_divergent_connect.suite())
     suite.addTest(test_connect_all_to_all.suite())
@@ -66,6 +73,7 @@ def suite():
     suite.addTest(test_getconnections.suite())
     suite.addTest(test_dataconnect.suite())
     suite.addTest(test_events.suite())
+    suite.addTest(test_spike_file.suite())
     suite.addTest(test_networks.suite())
     suite.addTest(test_threads.suite())    
     suite.addTest(test_csa.suite())    
@@ -138,6 +138,20 @@ class TestFixedOutDegree(TestParams):
         if M is not None:
             self.assertTrue(M.flatten, np.ones(N*N))
 
+    def testThreadIndependence(self):
+        # connections depend only on the global RNG, not on the number of threads
+        conn_params = self.conn_dict.copy()
+        conn_params['autapses'] = False
+        conn_params['multapses'] = False
+        conns = []
+        for n_threads in [1, 3]:
+            nest.ResetKernel()
+            nest.SetKernelStatus({'local_num_threads': n_threads})
+            pop = nest.Create('iaf_neuron', self.N1)
+            nest.Connect(pop, pop, conn_params)
+            conns.append(sorted((c[0], c[1]) for c in nest.GetConnections(pop, pop)))
+        self.assertEqual(conns[0], conns[1])
+
 def suite():
     suite = unittest.TestLoader().loadTestsFromTestCase(TestFixedOutDegree)
     return suite
@@ -61,6 +61,22 @@ class TestPairwiseBernoulli(TestParams):
                 ks, p = scipy.stats.kstest(pvalues, 'uniform', alternative='two_sided')
                 self.assertTrue( p > self.stat_dict['alpha2'] )
 
+    def testTotalNumber(self):
+        # mean number of connections is p*N_s*N_t, also for small p
+        conn_params = self.conn_dict.copy()
+        n_runs = 10
+        for p, N in [(0.1, 100), (1e-4, 1000)]:
+            conn_params['p'] = p
+            total = 0
+            for i in range(n_runs):
+                hf.reset_seed(i, self.nr_threads)
+                self.setUpNetwork(conn_dict=conn_params,N1=N,N2=N)
+                total += len(nest.GetConnections(self.pop1, self.pop2))
+            total = hf.gather_data(total)
+            if total != None:
+                expected = n_runs * p * N * N
+                self.assertTrue( abs(total - expected) < 5 * np.sqrt(expected * (1. - p)) )
+
     def testAutapses(self):
         conn_params = self.conn_dict.copy()
         N = 10
@@ -0,0 +1,175 @@
+# -*- coding: utf-8 -*-
+#
+# test_direct_api.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that the functions calling the kernel directly behave like the
+corresponding SLI commands
+"""
+
+import unittest
+import nest
+
+try:
+    import numpy
+    HAVE_NUMPY = True
+except ImportError:
+    HAVE_NUMPY = False
+
+
+def sli_get_status(nodes, key):
+    """GetStatus through the SLI interpreter"""
+
+    nest.sli_push(list(nodes))
+    nest.sli_run('{{ GetStatus /{0} get }} Map'.format(key))
+    return nest.sli_pop()
+
+
+@nest.check_stack
+class DirectApiTestCase(unittest.TestCase):
+    """Tests of the direct kernel calls of PyNEST"""
+
+    def test_Create(self):
+        """Create"""
+
+        nest.ResetKernel()
+
+        n = nest.Create('iaf_neuron', 3)
+        self.assertEqual(n, (1, 2, 3))
+
+        nest.sli_run('/iaf_neuron 2 Create')
+        self.assertEqual(nest.sli_pop(), 5)
+
+        n = nest.Create('iaf_neuron', 2)
+        self.assertEqual(n, (6, 7))
+
+        self.assertRaisesRegex(nest.NESTError, "RangeCheck", nest.Create, 'iaf_neuron', 0)
+
+    def test_SetGetStatus(self):
+        """SetStatus and GetStatus"""
+
+        nest.ResetKernel()
+
+        n = nest.Create('iaf_neuron', 4)
+
+        nest.SetStatus(n, {'I_e': 10.0})
+        self.assertEqual(nest.GetStatus(n, 'I_e'), (10.0,) * 4)
+
+        nest.SetStatus(n, [{'I_e': 1.0}, {'I_e': 2.0}, {'I_e': 3.0}, {'I_e': 4.0}])
+        self.assertEqual(nest.GetStatus(n, 'I_e'), sli_get_status(n, 'I_e'))
+
+        nest.SetStatus(n, 'C_m', [200.0, 210.0, 220.0, 230.0])
+        self.assertEqual(nest.GetStatus(n, 'C_m'), (200.0, 210.0, 220.0, 230.0))
+        self.assertEqual(nest.GetStatus(n, ['C_m', 'I_e'])[1], (210.0, 2.0))
+        self.assertEqual(nest.GetStatus(n)[3]['C_m'], 230.0)
+
+        self.assertRaisesRegex(nest.NESTError, "DictError", nest.GetStatus, n, 'nonexistent_status_key')
+        self.assertRaisesRegex(nest.NESTError, "DictError", nest.SetStatus, n, {'nonexistent_status_key': 0})
+        self.assertRaisesRegex(nest.NESTError, "UnknownNode", nest.GetStatus, (99, ))
+
+    @unittest.skipIf(not HAVE_NUMPY, 'NumPy package is not available')
+    def test_SetStatusArray(self):
+        """SetStatus with NumPy arrays of values"""
+
+        nest.ResetKernel()
+
+        n = nest.Create('iaf_neuron', 5)
+
+        nest.SetStatus(n, 'V_m', numpy.linspace(-70.0, -60.0, 5))
+        self.assertEqual(nest.GetStatus(n, 'V_m'), (-70.0, -67.5, -65.0, -62.5, -60.0))
+        self.assertEqual(nest.GetStatus(n, 'V_m'), sli_get_status(n, 'V_m'))
+
+        nest.SetStatus(n, 'I_e', numpy.arange(5.0, dtype=numpy.float32))
+        self.assertEqual(nest.GetStatus(n, 'I_e'), (0.0, 1.0, 2.0, 3.0, 4.0))
+
+        # integers are not converted, as in SLI
+        self.assertRaisesRegex(nest.NESTError, "TypeMismatch", nest.SetStatus, n, 'I_e', numpy.arange(5))
+
+    @unittest.skipIf(not HAVE_NUMPY, 'NumPy package is not available')
+    def test_SetStatusArray2D(self):
+        """SetStatus with rows of a two-dimensional NumPy array"""
+
+        nest.ResetKernel()
+
+        sg = nest.Create('spike_generator', 2)
+
+        nest.SetStatus(sg, 'spike_times', numpy.array([[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]]))
+        self.assertEqual(nest.GetStatus(sg, 'spike_times')[0].tolist(), [1.0, 2.0, 3.0])
+        self.assertEqual(nest.GetStatus(sg, 'spike_times')[1].tolist(), [4.0, 5.0, 6.0])
+
+    def test_Connect(self):
+        """Connect"""
+
+        nest.ResetKernel()
+
+        n = nest.Create('iaf_neuron', 3)
+
+        nest.Connect(n, n, 'one_to_one', 'stdp_synapse')
+        conns = nest.GetConnections(n, synapse_model='stdp_synapse')
+        self.assertEqual(len(conns), 3)
+
+        nest.Connect(n, n, {'rule': 'all_to_all'}, {'weight': 2.0, 'delay': 1.5})
+        conns = nest.GetConnections(n, synapse_model='static_synapse')
+        self.assertEqual(len(conns), 9)
+        self.assertEqual(nest.GetStatus(conns, 'weight'), (2.0, ) * 9)
+
+        if HAVE_NUMPY:
+            nest.Connect(numpy.array(n), numpy.array(n[:1]))
+            self.assertEqual(len(nest.GetConnections(n, n[:1])), 7)
+
+        self.assertRaisesRegex(nest.NESTError, "UnknownNode", nest.Connect, (99, ), (99, ))
+
+    def test_ConnectOptions(self):
+        """Connect completes specifications from its options"""
+
+        nest.ResetKernel()
+
+        n = nest.Create('iaf_neuron', 2)
+
+        nest.sli_run('/Connect << /syn_spec << /model /stdp_synapse >> >> SetOptions')
+        try:
+            nest.Connect(n, n, 'one_to_one', {'weight': 2.0})
+        finally:
+            nest.sli_run('/Connect ResetOptions')
+
+        self.assertEqual(len(nest.GetConnections(n, synapse_model='stdp_synapse')), 2)
+
+    def test_Simulate(self):
+        """Simulate"""
+
+        nest.ResetKernel()
+
+        nest.Simulate(10)
+        self.assertEqual(nest.GetKernelStatus('time'), 10.0)
+
+        self.assertRaises(nest.NESTError, nest.Simulate, -1.0)
+
+
+def suite():
+    suite = unittest.makeSuite(DirectApiTestCase, 'test')
+    return suite
+
+def run():
+    runner = unittest.TextTestRunner(verbosity=2)
+    runner.run(suite())
+
+
+if __name__ == "__main__":
+    run()
@@ -87,6 +87,65 @@ class EventsTestCase(unittest.TestCase):
         self.assert_(len(d['times'])>0)
         
 
+    def test_GetEventsNoCopy(self):
+        """Events are returned without copying"""
+
+        nest.ResetKernel()
+
+        nest.sr('20 setverbosity')
+
+        n  = nest.Create('iaf_neuron',1,{'I_e':1000.})
+        sd = nest.Create('spike_detector',1,{'withtime':True})
+        nest.Connect(n,sd)
+        nest.SetKernelStatus({'print_time':False})
+        nest.Simulate(100)
+
+        d = nest.GetEvents(sd)[0]
+
+        self.assertTrue(len(d['times']) > 0)
+        self.assertFalse(d['times'].flags.owndata)
+        self.assertFalse(d['senders'].flags.owndata)
+
+        # the kernel owns the data, so the arrays are read-only
+        self.assertFalse(d['times'].flags.writeable)
+        self.assertRaises(ValueError, d['times'].__setitem__, 0, -1.)
+
+        # data remains valid after the kernel has released it
+        times = d['times'].copy()
+        nest.SetStatus(sd, {'n_events': 0})
+        nest.Simulate(100)
+        self.assertTrue((d['times'] == times).all())
+
+
+    def test_GetEventsClear(self):
+        """Read and clear events"""
+
+        nest.ResetKernel()
+
+        nest.sr('20 setverbosity')
+        nest.SetKernelStatus({'local_num_threads': 2, 'print_time': False})
+
+        n  = nest.Create('iaf_neuron',4,{'I_e':1000.})
+        sd = nest.Create('spike_detector',2,{'withtime':True})
+        vm = nest.Create('voltmeter',1,{'withtime':True})
+        nest.Connect(n,sd[:1])
+        nest.Connect(n,sd[1:])
+        nest.Connect(vm,n)
+
+        times, vms = [], []
+        for i in range(3):
+            nest.Simulate(100)
+            d_sd, d_vm = nest.GetEvents([sd[0], vm[0]], clear=True)
+            times.extend(d_sd['times'])
+            vms.extend(d_vm['V_m'])
+            self.assertEqual(nest.GetStatus(sd[:1], 'n_events')[0], 0)
+            self.assertEqual(len(nest.GetStatus(vm, 'events')[0]['V_m']), 0)
+
+        d = nest.GetStatus(sd[1:], 'events')[0]
+        self.assertEqual(sorted(times), sorted(d['times']))
+        self.assertEqual(len(vms), 4 * 299)
+
+
 def suite():
 
     suite = unittest.makeSuite(EventsTestCase,'test')
@@ -0,0 +1,132 @@
+# -*- coding: utf-8 -*-
+#
+# test_prepare_run_cleanup.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Tests of Prepare, Run and Cleanup and of the spike callback
+"""
+
+import unittest
+import nest
+
+
+def build_network():
+    """Create neurons which spike at different times and a spike_detector"""
+
+    nest.ResetKernel()
+    nest.set_verbosity('M_WARNING')
+
+    n = nest.Create('iaf_psc_alpha', 10)
+    for i, gid in enumerate(n):
+        nest.SetStatus([gid], {'I_e': 376.0 + 10.0 * i})
+    nest.Connect(n, n, {'rule': 'fixed_indegree', 'indegree': 2}, {'weight': 50.0})
+
+    sd = nest.Create('spike_detector')
+    nest.Connect(n, sd)
+
+    return sd
+
+
+def recorded_spikes(sd):
+    """Return the spikes of the spike_detector sorted by time and gid"""
+
+    events = nest.GetStatus(sd, 'events')[0]
+    return sorted(zip(events['times'], events['senders']))
+
+
+@nest.check_stack
+class PrepareRunCleanupTestCase(unittest.TestCase):
+    """Tests of Prepare, Run and Cleanup"""
+
+    def tearDown(self):
+
+        nest.SetSpikeCallback(None)
+
+    def test_RunSteps(self):
+        """Run in steps gives the same spikes as Simulate"""
+
+        sd = build_network()
+        nest.Simulate(200.0)
+        reference = recorded_spikes(sd)
+
+        sd = build_network()
+        with nest.RunManager():
+            for i in range(200):
+                nest.Run(1.0)
+
+        self.assertTrue(len(reference) > 0)
+        self.assertEqual(recorded_spikes(sd), reference)
+        self.assertEqual(nest.GetKernelStatus('time'), 200.0)
+
+    def test_WrongOrder(self):
+        """Run and Cleanup need Prepare, Simulate must not follow it"""
+
+        nest.ResetKernel()
+
+        self.assertRaisesRegex(nest.NESTError, "Run_d", nest.Run, 10.0)
+        self.assertRaises(nest.NESTError, nest.Cleanup)
+
+        nest.Prepare()
+        self.assertRaises(nest.NESTError, nest.Simulate, 10.0)
+        self.assertRaises(nest.NESTError, nest.Prepare)
+        nest.Cleanup()
+
+        nest.Simulate(10.0)
+        self.assertEqual(nest.GetKernelStatus('time'), 10.0)
+
+    def test_SpikeCallback(self):
+        """The spike callback gets the spikes the spike_detector records"""
+
+        received = []
+
+        def callback(gids, times):
+            received.extend(zip(times, gids))
+
+        nest.SetSpikeCallback(callback)
+
+        sd = build_network()
+        nest.Simulate(100.0)
+        with nest.RunManager():
+            for i in range(100):
+                nest.Run(1.0)
+
+        # The spike_detector gets the spikes of the last time slice
+        # only at the beginning of the next one.
+        spikes = [s for s in sorted(received) if s[0] <= 199.0]
+        self.assertTrue(len(spikes) > 0)
+        self.assertEqual(spikes, recorded_spikes(sd))
+
+        nest.SetSpikeCallback(None)
+        del received[:]
+        nest.Simulate(100.0)
+        self.assertEqual(received, [])
+
+
+def suite():
+    suite = unittest.makeSuite(PrepareRunCleanupTestCase, 'test')
+    return suite
+
+def run():
+    runner = unittest.TextTestRunner(verbosity=2)
+    runner.run(suite())
+
+
+if __name__ == "__main__":
+    run()
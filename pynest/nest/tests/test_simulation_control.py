@@ -0,0 +1,164 @@
+# -*- coding: utf-8 -*-
+#
+# test_simulation_control.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that other Python threads run during Simulate and can follow and
+interrupt the simulation
+"""
+
+import unittest
+import threading
+import time
+import nest
+
+
+def build_network():
+    """Create a network that takes a while to simulate"""
+
+    nest.ResetKernel()
+    nest.set_verbosity('M_WARNING')
+
+    n = nest.Create('iaf_psc_alpha', 2000, {'I_e': 400.0})
+    nest.Connect(n, n, {'rule': 'fixed_indegree', 'indegree': 10}, {'weight': 0.1})
+
+
+class Monitor(threading.Thread):
+    """
+    Record the progress of the simulation, optionally interrupt it.
+    The monitor starts when the event started is set, right before
+    Simulate() is called.
+    """
+
+    def __init__(self, interrupt=False):
+
+        threading.Thread.__init__(self)
+        self.daemon = True
+        self.interrupt = interrupt
+        self.progress = []
+        self.started = threading.Event()
+        self.finished = False
+
+    def run(self):
+
+        self.started.wait()
+
+        if self.interrupt:
+            # Simulate() discards earlier interrupts before the kernel
+            # starts, so interrupt once the kernel reports remaining steps
+            while not self.finished:
+                done, total = nest.GetSimulationProgress()
+                if done < total:
+                    nest.InterruptSimulation()
+                    break
+            return
+
+        while not self.finished:
+            self.progress.append(nest.GetSimulationProgress())
+            time.sleep(0.001)
+
+
+@nest.check_stack
+class SimulationControlTestCase(unittest.TestCase):
+    """Tests of GetSimulationProgress and InterruptSimulation"""
+
+    def test_Progress(self):
+        """Other threads run and see the progress during Simulate"""
+
+        build_network()
+
+        monitor = Monitor()
+        monitor.start()
+        try:
+            monitor.started.set()
+            nest.Simulate(500.0)
+        finally:
+            monitor.finished = True
+            monitor.join()
+
+        self.assertTrue(any(0.0 < done < total for done, total in monitor.progress))
+        self.assertEqual(nest.GetSimulationProgress(), (500.0, 500.0))
+
+    def test_Interrupt(self):
+        """InterruptSimulation stops Simulate, which can be resumed"""
+
+        build_network()
+
+        monitor = Monitor(interrupt=True)
+        monitor.start()
+        try:
+            monitor.started.set()
+            self.assertRaisesRegex(nest.NESTError, "SimulationInterrupted", nest.Simulate, 500.0)
+        finally:
+            monitor.finished = True
+            monitor.join()
+
+        self.assertLess(nest.GetKernelStatus('time'), 500.0)
+
+        nest.ResumeSimulation()
+        self.assertEqual(nest.GetKernelStatus('time'), 500.0)
+
+    def test_ConcurrentCalls(self):
+        """Calls from several threads do not mix their stack contents"""
+
+        nest.ResetKernel()
+
+        models = ['neuron_{0}'.format(i) for i in range(4)]
+        for i, model in enumerate(models):
+            nest.CopyModel('iaf_neuron', model, {'C_m': 100.0 + i})
+
+        errors = []
+
+        def get_defaults(model, expected):
+            for i in range(200):
+                value = nest.GetDefaults(model, 'C_m')
+                if value != expected:
+                    errors.append((model, value))
+
+        threads = [threading.Thread(target=get_defaults, args=(model, 100.0 + i))
+                   for i, model in enumerate(models)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+
+        self.assertEqual(errors, [])
+
+    def test_InterruptIdle(self):
+        """InterruptSimulation has no effect without a running simulation"""
+
+        nest.ResetKernel()
+
+        nest.InterruptSimulation()
+        nest.Simulate(10.0)
+        self.assertEqual(nest.GetKernelStatus('time'), 10.0)
+
+
+def suite():
+    suite = unittest.makeSuite(SimulationControlTestCase, 'test')
+    return suite
+
+def run():
+    runner = unittest.TextTestRunner(verbosity=2)
+    runner.run(suite())
+
+
+if __name__ == "__main__":
+    run()
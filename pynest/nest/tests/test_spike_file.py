@@ -0,0 +1,133 @@
+# -*- coding: utf-8 -*-
+#
+# test_spike_file.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test of binary spike files
+"""
+
+import os
+import shutil
+import tempfile
+import unittest
+import nest
+
+try:
+    import numpy
+    from nest import spike_file
+    HAVE_NUMPY = True
+except ImportError:
+    HAVE_NUMPY = False
+
+
+@nest.check_stack
+@unittest.skipIf(not HAVE_NUMPY, 'NumPy package is not available')
+class SpikeFileTestCase(unittest.TestCase):
+    """Tests of reading and merging binary spike files"""
+
+
+    def setUp(self):
+
+        self.tmpdir = tempfile.mkdtemp()
+
+        nest.ResetKernel()
+        nest.sr('M_ERROR setverbosity')
+        nest.SetKernelStatus({'local_num_threads': 2,
+                              'data_path': self.tmpdir,
+                              'overwrite_files': True,
+                              'print_time': False})
+
+        n = nest.Create('iaf_psc_alpha', 10)
+        nest.SetStatus(n, 'I_e', [376.0 + 5.0 * i for i in range(10)])
+        self.sd = nest.Create('spike_detector', 1,
+                              {'to_file': True, 'to_memory': True,
+                               'binary': True, 'chunk_size': 7})
+        nest.Connect(n, self.sd)
+
+        nest.Simulate(300.0)
+
+        self.events = nest.GetStatus(self.sd, 'events')[0]
+        self.files = nest.GetStatus(self.sd, 'filenames')[0]
+
+    def tearDown(self):
+
+        shutil.rmtree(self.tmpdir)
+
+    def assertSameSpikes(self, d, senders, times):
+
+        order = numpy.lexsort((senders, times))
+        self.assertTrue(numpy.all(d['senders'] == senders[order]))
+        self.assertTrue(numpy.allclose(d['times'], times[order]))
+
+
+    def test_ReadAll(self):
+        """Read all spikes from binary files"""
+
+        self.assertEqual(len(self.files), 2)
+        self.assertTrue(len(self.events['times']) > 20)
+
+        d = spike_file.read_spike_files(self.files)
+        self.assertSameSpikes(d, self.events['senders'], self.events['times'])
+
+        f = spike_file.SpikeFile(self.files[0])
+        self.assertEqual(f.resolution, nest.GetKernelStatus('resolution'))
+        self.assertTrue(len(f.chunk_n) > 1)
+        self.assertTrue(numpy.all(f.chunk_n <= 7))
+
+
+    def test_ReadSelection(self):
+        """Read spikes from time window and selected GIDs"""
+
+        gids = [2, 5, 6]
+        d = spike_file.read_spike_files(self.files, t_min=100.0,
+                                        t_max=200.0, gids=gids)
+
+        senders = self.events['senders']
+        times = self.events['times']
+        sel = (times >= 100.0) & (times < 200.0) & numpy.in1d(senders, gids)
+        self.assertSameSpikes(d, senders[sel], times[sel])
+
+        f = spike_file.SpikeFile(self.files[0])
+        self.assertTrue(len(f.select_chunks(t_min=100.0, t_max=200.0))
+                        < len(f.chunk_n))
+
+
+    def test_Merge(self):
+        """Merge binary files into one time-ordered file"""
+
+        merged = os.path.join(self.tmpdir, 'merged.gdf')
+        spike_file.merge_spike_files(self.files, merged, chunk_size=5)
+
+        f = spike_file.SpikeFile(merged)
+        d = f.read()
+        self.assertTrue(numpy.all(numpy.diff(d['times']) >= 0))
+        self.assertSameSpikes(d, self.events['senders'], self.events['times'])
+
+
+def suite():
+
+    suite = unittest.makeSuite(SpikeFileTestCase,'test')
+    return suite
+
+
+if __name__ == "__main__":
+
+    runner = unittest.TextTestRunner(verbosity=2)
+    runner.run(suite())
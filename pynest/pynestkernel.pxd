@@ -29,6 +29,7 @@ from cpython.ref cimport PyObject
 
 cdef extern from "name.h":
     cppclass Name:
+        Name(const string&) except +
         string toString() except +
 
 cdef extern from "datum.h":
@@ -96,9 +97,11 @@ cdef extern from "arraydatum.h":
 
     cppclass IntVectorDatum:
         IntVectorDatum(vector[long]*) except +
+        IntVectorDatum(const IntVectorDatum&) except +
 
     cppclass DoubleVectorDatum:
         DoubleVectorDatum(vector[double]*) except +
+        DoubleVectorDatum(const DoubleVectorDatum&) except +
 
 cdef extern from "dict.h":
     cppclass Dictionary:
@@ -115,6 +118,8 @@ cdef extern from "dictdatum.h":
     cppclass DictionaryDatum:
         DictionaryDatum(Dictionary *) except +
         void insert(const string&, Datum*) except +
+        cbool known(const Name&) except +
+        const Token& lookup(const Name&) except +
         TokenMap.const_iterator begin()
         TokenMap.const_iterator end()
 
@@ -130,16 +135,34 @@ cdef extern from "tokenstack.h":
 cdef extern from "interpret.h":
     cppclass SLIInterpreter:
         SLIInterpreter() except +
-        int execute(const string&) except +
+        int execute(const string&) except + nogil
         TokenStack OStack
 
+cdef extern from "spike_observer.h" namespace "nest":
+    cppclass SpikeBuffer:
+        SpikeBuffer()
+        size_t size()
+        void swap(vector[size_t]&, vector[double]&)
+
 cdef extern from "network.h" namespace "nest":
-    cppclass Network
+    cppclass Network:
+        void interrupt() nogil
+        void clear_interrupt()
+        void get_simulation_progress(double&, double&) nogil
+        void add_spike_observer(SpikeBuffer*)
+        void remove_spike_observer(SpikeBuffer*)
 
 cdef extern from "neststartup.h":
     int neststartup(int, char**, SLIInterpreter&, Network*&, string) except +
     void nestshutdown() except +
 
+    long pynest_create(Network&, const string&, long) except + nogil
+    void pynest_simulate(SLIInterpreter&, Network&, double) except + nogil
+    void pynest_run(Network&, double) except + nogil
+    void pynest_set_status(Network&, long, const DictionaryDatum&) except + nogil
+    DictionaryDatum* pynest_get_status(Network&, long) except + nogil
+    void pynest_connect(SLIInterpreter&, Network&, const IntVectorDatum&, const IntVectorDatum&, DictionaryDatum&, DictionaryDatum&) except + nogil
+
 
 cdef extern from *:
 
@@ -147,6 +170,7 @@ cdef extern from *:
     # or else we won't be able to distribute pre-generated kernels
     #
     cbool isConnectionGenerator "CYTHON_isConnectionGenerator" (PyObject*)
+    cbool run_needs_gil "CYTHON_RUN_NEEDS_GIL"
     Datum* unpackConnectionGeneratorDatum "CYTHON_unpackConnectionGeneratorDatum" (PyObject*) except +
 
     Token* addr_tok "CYTHON_ADDR" (Token*)
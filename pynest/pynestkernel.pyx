@@ -23,6 +23,7 @@
 #
 
 import cython
+import threading
 
 from libc.stdlib cimport malloc, free
 from libc.string cimport memcpy
@@ -108,6 +109,42 @@ cdef class SLIDatum(object):
         self.thisptr = dat
 
 
+cdef class SLIVectorView(object):
+    """
+    View of the data of an SLI vector datum, which NumPy arrays can
+    use without copying the data. The view holds a reference to the
+    datum, so the data stays valid as long as any array uses it. The
+    arrays are read-only, because the kernel owns the data.
+    """
+
+    cdef Datum* thisptr
+    cdef object _interface
+
+    def __cinit__(self):
+
+        self.thisptr = NULL
+        self._interface = None
+
+    def __dealloc__(self):
+
+        if self.thisptr is not NULL:
+            del self.thisptr
+
+    property __array_interface__:
+        def __get__(self):
+            return self._interface
+
+    cdef _set_datum(self, Datum* dat, size_t data, size_t n, object typestr):
+
+        self.thisptr = dat
+        self._interface = {
+            'version': 3,
+            'shape': (n,),
+            'typestr': typestr,
+            'data': (data, True),
+        }
+
+
 cdef class SLILiteral(object):
 
     cdef readonly object name
@@ -152,14 +189,31 @@ cdef class SLILiteral(object):
 
 
 cdef class NESTEngine(object):
+    """
+    The NEST kernel and its SLI interpreter.
+
+    Simulate, connect and the status calls release the GIL while the
+    kernel works, so that other Python threads keep running. The
+    engine itself is used by one thread at a time: a call from another
+    thread waits until the running call has returned. Only interrupt()
+    and get_simulation_progress() may be called while another thread
+    uses the engine. Sequences of push(), run() and pop() that belong
+    together hold _lock, a reentrant lock, around the whole sequence.
+    """
 
     cdef SLIInterpreter* pEngine
     cdef Network* pNet
+    cdef readonly object _lock
+    cdef SpikeBuffer* spike_buffer
+    cdef object spike_callback
 
     def __cinit__(self):
 
         self.pNet = NULL
         self.pEngine = NULL
+        self._lock = threading.RLock()
+        self.spike_buffer = NULL
+        self.spike_callback = None
 
     def __dealloc__(self):
 
@@ -167,9 +221,11 @@ cdef class NESTEngine(object):
 
         del self.pNet
         del self.pEngine
+        del self.spike_buffer
 
         self.pNet = NULL
         self.pEngine = NULL
+        self.spike_buffer = NULL
 
     def init(self, argv, modulepath):
 
@@ -212,28 +268,38 @@ cdef class NESTEngine(object):
 
         cdef string cmd_bytes = cmd.encode()
 
-        self.pEngine.execute(cmd_bytes)
+        with self._lock:
+            self.pNet.clear_interrupt()
+            if run_needs_gil:
+                self.pEngine.execute(cmd_bytes)
+            else:
+                with nogil:
+                    self.pEngine.execute(cmd_bytes)
 
     def push(self, obj):
 
         if self.pEngine is NULL:
             raise NESTError("engine uninitialized")
 
-        self.pEngine.OStack.push(python_object_to_datum(obj))
+        with self._lock:
+            self.pEngine.OStack.push(python_object_to_datum(obj))
 
     def pop(self):
 
         if self.pEngine is NULL:
             raise NESTError("engine uninitialized")
 
-        if self.pEngine.OStack.empty():
-            raise NESTError("interpreter stack is empty")
+        cdef Datum* dat = NULL
 
-        cdef Datum* dat = (addr_tok(self.pEngine.OStack.top())).datum()
+        with self._lock:
+            if self.pEngine.OStack.empty():
+                raise NESTError("interpreter stack is empty")
 
-        ret = sli_datum_to_object(dat)
+            dat = (addr_tok(self.pEngine.OStack.top())).datum()
 
-        self.pEngine.OStack.pop()
+            ret = sli_datum_to_object(dat)
+
+            self.pEngine.OStack.pop()
 
         return ret
 
@@ -253,12 +319,326 @@ cdef class NESTEngine(object):
 
                 connectome.push_back(<Datum*> cdt)
 
-            self.pEngine.OStack.push(<Datum*> connectome)
+            with self._lock:
+                self.pEngine.OStack.push(<Datum*> connectome)
 
         except:
             del connectome
             raise
 
+    # The following methods call the kernel directly for the frequent
+    # functions of the high-level API. They do the same as the SLI
+    # commands, but convert their arguments without the operand stack
+    # and without parsing a command string.
+
+    def create(self, model, long n):
+        """
+        Create n nodes of the given model and return the GID of the
+        last one, like Create.
+        """
+
+        if self.pEngine is NULL:
+            raise NESTError("engine uninitialized")
+
+        cdef string model_str = str(model).encode()
+        cdef long last = 0
+
+        try:
+            with self._lock, nogil:
+                last = pynest_create(deref(self.pNet), model_str, n)
+        except RuntimeError as e:
+            raise NESTError(str(e)) from None
+
+        return last
+
+    def simulate(self, double t):
+        """
+        Simulate for t milliseconds, like Simulate.
+        """
+
+        if self.pEngine is NULL:
+            raise NESTError("engine uninitialized")
+
+        try:
+            with self._lock:
+                self.pNet.clear_interrupt()
+                with nogil:
+                    pynest_simulate(deref(self.pEngine), deref(self.pNet), t)
+        except RuntimeError as e:
+            raise NESTError(str(e)) from None
+
+        self.deliver_spikes()
+
+    def run_prepared(self, double t):
+        """
+        Simulate for t milliseconds after Prepare, like Run.
+        """
+
+        if self.pEngine is NULL:
+            raise NESTError("engine uninitialized")
+
+        try:
+            with self._lock:
+                self.pNet.clear_interrupt()
+                with nogil:
+                    pynest_run(deref(self.pNet), t)
+        except RuntimeError as e:
+            raise NESTError(str(e)) from None
+
+        self.deliver_spikes()
+
+    def set_spike_callback(self, callback):
+        """
+        Call callback(gids, times) with the spikes of the local neurons
+        after each call to simulate() and run_prepared(). None removes
+        the callback. The spikes are collected by the kernel at the end
+        of each time slice, without a spike_detector.
+        """
+
+        if self.pEngine is NULL:
+            raise NESTError("engine uninitialized")
+
+        with self._lock:
+            if callback is None:
+                if self.spike_buffer is not NULL:
+                    self.pNet.remove_spike_observer(self.spike_buffer)
+                    del self.spike_buffer
+                    self.spike_buffer = NULL
+            elif self.spike_buffer is NULL:
+                self.spike_buffer = new SpikeBuffer()
+                self.pNet.add_spike_observer(self.spike_buffer)
+
+            self.spike_callback = callback
+
+    def deliver_spikes(self):
+        """
+        Hand the spikes collected since the last call to the spike
+        callback. Spikes of a failed or interrupted simulation are
+        handed over after the next successful one.
+        """
+
+        cdef vector[size_t] gids
+        cdef vector[double] times
+
+        with self._lock:
+            if self.spike_buffer is NULL or self.spike_buffer.size() == 0:
+                return
+
+            self.spike_buffer.swap(gids, times)
+            callback = self.spike_callback
+
+        callback(*spikes_to_arrays(gids, times))
+
+    def set_status(self, gids, params):
+        """
+        Set the status of the nodes gids to params, which is either a
+        dictionary for all nodes or a list of dictionaries, one for
+        each node.
+        """
+
+        if self.pEngine is NULL:
+            raise NESTError("engine uninitialized")
+
+        cdef long gid
+        cdef Datum* dat = NULL
+
+        try:
+            with self._lock:
+                if isinstance(params, dict):
+                    dat = python_object_to_datum(params)
+                    for gid in gids:
+                        with nogil:
+                            pynest_set_status(deref(self.pNet), gid, deref(<DictionaryDatum*> dat))
+                else:
+                    for gid, p in zip(gids, params):
+                        if not isinstance(p, dict):
+                            raise TypeError("params must be a dictionary or a list of dictionaries")
+                        dat = python_object_to_datum(p)
+                        with nogil:
+                            pynest_set_status(deref(self.pNet), gid, deref(<DictionaryDatum*> dat))
+                        del dat
+                        dat = NULL
+        except RuntimeError as e:
+            raise NESTError(str(e)) from None
+        finally:
+            del dat
+
+    def set_status_values(self, gids, key, values):
+        """
+        Set the status entry key of each of the nodes gids to the
+        corresponding element of values. One-dimensional NumPy arrays
+        of numbers are read without creating a Python object for each
+        element. Other values, such as the rows of a two-dimensional
+        array, are converted element by element.
+        """
+
+        if self.pEngine is NULL:
+            raise NESTError("engine uninitialized")
+
+        cdef size_t i
+        cdef long gid
+        cdef double[:] dvalues
+        cdef long[:] lvalues
+
+        cdef string key_str = str(key).encode()
+        cdef DictionaryDatum* dd = new DictionaryDatum(new Dictionary())
+
+        try:
+            with self._lock:
+                if HAVE_NUMPY and isinstance(values, numpy.ndarray) and values.ndim == 1 and numpy.issubdtype(values.dtype, numpy.floating):
+                    dvalues = numpy.ascontiguousarray(values, dtype=numpy.double)
+                    for i, gid in enumerate(gids):
+                        deref_dict(dd).insert(key_str, <Datum*> new DoubleDatum(dvalues[i]))
+                        with nogil:
+                            pynest_set_status(deref(self.pNet), gid, deref(dd))
+                elif HAVE_NUMPY and isinstance(values, numpy.ndarray) and values.ndim == 1 and numpy.issubdtype(values.dtype, numpy.integer):
+                    lvalues = numpy.ascontiguousarray(values, dtype=numpy.int_)
+                    for i, gid in enumerate(gids):
+                        deref_dict(dd).insert(key_str, <Datum*> new IntegerDatum(lvalues[i]))
+                        with nogil:
+                            pynest_set_status(deref(self.pNet), gid, deref(dd))
+                else:
+                    for gid, v in zip(gids, values):
+                        deref_dict(dd).insert(key_str, python_object_to_datum(v))
+                        with nogil:
+                            pynest_set_status(deref(self.pNet), gid, deref(dd))
+        except RuntimeError as e:
+            raise NESTError(str(e)) from None
+        finally:
+            del dd
+
+    def get_status(self, gids, keys=None):
+        """
+        Return the status dictionaries of the nodes gids, like
+        GetStatus. If keys is a string, the value of this entry is
+        returned for each node, if it is a list, a tuple of values.
+        Only the requested entries are converted to Python objects.
+        """
+
+        if self.pEngine is NULL:
+            raise NESTError("engine uninitialized")
+
+        cdef long gid
+        cdef DictionaryDatum* dd = NULL
+
+        cdef vector[string] keys_str
+        cdef bint single = False
+
+        if isinstance(keys, (str, unicode, SLILiteral)):
+            keys_str.push_back(str(keys).encode())
+            single = True
+        elif keys is not None:
+            for k in keys:
+                keys_str.push_back(str(k).encode())
+
+        result = []
+
+        try:
+            with self._lock:
+                for gid in gids:
+                    with nogil:
+                        dd = pynest_get_status(deref(self.pNet), gid)
+                    if keys is None:
+                        result.append(sli_dict_to_object(dd))
+                    elif single:
+                        result.append(sli_dict_get_object(dd, keys_str[0]))
+                    else:
+                        result.append(tuple([sli_dict_get_object(dd, k) for k in keys_str]))
+                    del dd
+                    dd = NULL
+        except RuntimeError as e:
+            raise NESTError(str(e)) from None
+        finally:
+            del dd
+
+        return tuple(result)
+
+    def connect(self, pre, post, conn_spec=None, syn_spec=None):
+        """
+        Connect the nodes pre to the nodes post, like Connect. pre and
+        post are lists or NumPy arrays of GIDs. The given conn_spec and
+        syn_spec dictionaries are completed from the options of
+        Connect.
+        """
+
+        if self.pEngine is NULL:
+            raise NESTError("engine uninitialized")
+
+        cdef Datum* sources = NULL
+        cdef Datum* targets = NULL
+        cdef Datum* conn_dat = NULL
+        cdef Datum* syn_dat = NULL
+
+        try:
+            sources = python_gids_to_datum(pre)
+            targets = python_gids_to_datum(post)
+            conn_dat = python_object_to_datum({} if conn_spec is None else conn_spec)
+            syn_dat = python_object_to_datum({} if syn_spec is None else syn_spec)
+
+            with self._lock, nogil:
+                pynest_connect(deref(self.pEngine), deref(self.pNet),
+                               deref(<IntVectorDatum*> sources), deref(<IntVectorDatum*> targets),
+                               deref(<DictionaryDatum*> conn_dat), deref(<DictionaryDatum*> syn_dat))
+        except RuntimeError as e:
+            raise NESTError(str(e)) from None
+        finally:
+            del sources
+            del targets
+            del conn_dat
+            del syn_dat
+
+    # The following methods may be called from any thread, also while
+    # another thread simulates.
+
+    def interrupt(self):
+        """
+        Stop the running simulation at the end of the current time
+        slice. Simulate then raises a NESTError (SimulationInterrupted)
+        and the simulation can be continued with ResumeSimulation.
+        Each call that may simulate discards earlier interrupts before
+        it releases the GIL, so an interrupt takes effect if it is
+        requested after that point.
+        """
+
+        if self.pEngine is NULL:
+            raise NESTError("engine uninitialized")
+
+        self.pNet.interrupt()
+
+    def get_simulation_progress(self):
+        """
+        Return the simulated time and the requested time of the current
+        call to Simulate in ms.
+        """
+
+        if self.pEngine is NULL:
+            raise NESTError("engine uninitialized")
+
+        cdef double done = 0.0
+        cdef double total = 0.0
+
+        self.pNet.get_simulation_progress(done, total)
+
+        return done, total
+
+cdef inline object spikes_to_arrays(const vector[size_t]& gids, const vector[double]& times):
+
+    cdef size_t n = gids.size()
+    cdef array.array gid_arr = array.clone(ARRAY_LONG, n, False)
+    cdef array.array time_arr = array.clone(ARRAY_DOUBLE, n, False)
+    cdef size_t i
+
+    for i in range(n):
+        gid_arr.data.as_longs[i] = gids[i]
+
+    if n > 0:
+        memcpy(time_arr.data.as_doubles, &times.front(), n * sizeof(double))
+
+    if HAVE_NUMPY:
+        return numpy.frombuffer(gid_arr, dtype=numpy.int_), numpy.frombuffer(time_arr, dtype=numpy.float_)
+    else:
+        return gid_arr, time_arr
+
 cdef inline Datum* python_object_to_datum(obj) except NULL:
 
     cdef Datum* ret = NULL
@@ -354,6 +734,23 @@ cdef inline Datum* python_object_to_datum(obj) except NULL:
 
     return ret
 
+cdef inline Datum* python_gids_to_datum(obj) except NULL:
+
+    if isinstance(obj, (tuple, list, xrange)):
+        return python_buffer_to_datum[object, long](obj)
+
+    try:
+        return python_buffer_to_datum[buffer_long_1d_t, long](obj)
+    except (ValueError, TypeError):
+        pass
+
+    try:
+        return python_buffer_to_datum[buffer_int_1d_t, long](obj)
+    except (ValueError, TypeError):
+        pass
+
+    return python_buffer_to_datum[object, long](obj)
+
 @cython.boundscheck(False)
 cdef inline Datum* python_buffer_to_datum(numeric_buffer_t buff, vector_value_t _ = 0) except NULL:
 
@@ -454,6 +851,13 @@ cdef inline object sli_dict_to_object(DictionaryDatum* dat):
 
     return tmp
 
+cdef inline object sli_dict_get_object(DictionaryDatum* dat, const string& key):
+
+    if not deref_dict(dat).known(Name(key)):
+        raise NESTError("DictError in get_d: Key '/{0}' does not exist in dictionary.".format(key.decode()))
+
+    return sli_datum_to_object(deref_dict(dat).lookup(Name(key)).datum())
+
 cdef inline object sli_connection_to_object(ConnectionDatum* dat):
 
     cdef array.array arr
@@ -473,29 +877,41 @@ cdef inline object sli_vector_to_object(sli_vector_ptr_t dat, vector_value_t _ =
 
     cdef vector_value_t* array_data = NULL
     cdef vector[vector_value_t]* vector_ptr = NULL
+    cdef Datum* view_dat = NULL
 
     if sli_vector_ptr_t is sli_vector_int_ptr_t and vector_value_t is long:
         vector_ptr = deref_ivector(dat)
-        arr = array.clone(ARRAY_LONG, vector_ptr.size(), False)
-        array_data = arr.data.as_longs
         if HAVE_NUMPY:
             ret_dtype = numpy.int_
+            if vector_ptr.size() > 0:
+                view_dat = <Datum*> new IntVectorDatum(deref(dat))
+        else:
+            arr = array.clone(ARRAY_LONG, vector_ptr.size(), False)
+            array_data = arr.data.as_longs
     elif sli_vector_ptr_t is sli_vector_double_ptr_t and vector_value_t is double:
         vector_ptr = deref_dvector(dat)
-        arr = array.clone(ARRAY_DOUBLE, vector_ptr.size(), False)
-        array_data = arr.data.as_doubles
         if HAVE_NUMPY:
             ret_dtype = numpy.float_
+            if vector_ptr.size() > 0:
+                view_dat = <Datum*> new DoubleVectorDatum(deref(dat))
+        else:
+            arr = array.clone(ARRAY_DOUBLE, vector_ptr.size(), False)
+            array_data = arr.data.as_doubles
     else:
         raise NESTError("unsupported specialization")
 
-    memcpy(array_data, &vector_ptr.front(), vector_ptr.size() * sizeof(vector_value_t))
-
     if HAVE_NUMPY:
         if vector_ptr.size() > 0:
-            return numpy.frombuffer(arr, dtype=ret_dtype)
+            # The copied datum shares the vector with dat, so the array
+            # uses the kernel-side data without copying it. The array
+            # is read-only, so Python code cannot modify kernel data.
+            view = SLIVectorView()
+            (<SLIVectorView> view)._set_datum(view_dat, <size_t> &vector_ptr.front(),
+                                              vector_ptr.size(), numpy.dtype(ret_dtype).str)
+            return numpy.asarray(view)
         else:
             # Compatibility with NumPy < 1.7.0
             return numpy.array([], dtype=ret_dtype)
     else:
+        memcpy(array_data, &vector_ptr.front(), vector_ptr.size() * sizeof(vector_value_t))
         return arr
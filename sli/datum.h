@@ -23,6 +23,7 @@
 #ifndef DATUM_H
 #define DATUM_H
 
+#include "config.h"
 #include "slitype.h"
 
 /***********************************************************/
@@ -88,16 +89,31 @@ class Datum
   virtual ~Datum() {};
   
 
+  /**
+   * Reference counting is not thread-safe by default. If NEST is
+   * configured with --enable-atomic-refcount, the counter is updated
+   * with atomic operations, so that Tokens referring to the same
+   * Datum may be copied and destroyed by several threads.
+   */
   void addReference() const
   {
+#ifdef SLI_ATOMIC_REFCOUNT
+    __sync_fetch_and_add(&reference_count_, 1);
+#else
     ++reference_count_;
+#endif
   }
 
   void removeReference()
   {
+#ifdef SLI_ATOMIC_REFCOUNT
+    if(__sync_sub_and_fetch(&reference_count_, 1)==0)
+      delete this;
+#else
     --reference_count_;
     if(reference_count_==0)
       delete this;
+#endif
   }
 
   size_t numReferences() const
@@ -150,6 +166,14 @@ class Datum
       return type->gettypename();
     }
 
+  /**
+   * Return the action executed for this datum.
+   */
+  const SLIFunction * get_action() const
+    {
+      return action;
+    }
+
   bool isoftype(SLIType const &t) const
     {
       return (type==&t);  // or: *type==t, there is only one t with same contents !
@@ -30,6 +30,152 @@
 #include <cstdlib>
 #include <string>
 
+TokenMap::TokenMap(const TokenMap &m)
+  : slots_(),
+    order_(),
+    mask_(0),
+    shift_(0)
+{
+  order_.reserve(m.order_.size());
+  for ( size_t k = 0 ; k < m.order_.size() ; ++k )
+  {
+    Node *node = new Node(m.order_[k]->value.first, m.order_[k]->value.second);
+    node->pos = k;
+    order_.push_back(node);
+  }
+  if ( !m.slots_.empty() )
+    rehash_(m.slots_.size());
+}
+
+TokenMap::~TokenMap()
+{
+  for ( size_t k = 0 ; k < order_.size() ; ++k )
+    delete order_[k];
+}
+
+TokenMap& TokenMap::operator=(const TokenMap &m)
+{
+  if ( this != &m )
+  {
+    TokenMap tmp(m);
+    slots_.swap(tmp.slots_);
+    order_.swap(tmp.order_);
+    std::swap(mask_, tmp.mask_);
+    std::swap(shift_, tmp.shift_);
+  }
+  return *this;
+}
+
+size_t TokenMap::erase(const Name &n)
+{
+  Node *node = find_node_(n);
+  if ( node == 0 )
+    return 0;
+  remove_node_(node);
+  return 1;
+}
+
+void TokenMap::erase(iterator it)
+{
+  remove_node_(*it.p_);
+}
+
+void TokenMap::clear()
+{
+  for ( size_t k = 0 ; k < order_.size() ; ++k )
+    delete order_[k];
+  order_.clear();
+  slots_.clear();
+  mask_ = 0;
+  shift_ = 0;
+}
+
+namespace
+{
+  template <typename N>
+  bool handle_less(const N *a, const N *b)
+  {
+    return a->value.first.toIndex() < b->value.first.toIndex();
+  }
+}
+
+TokenMap::Node* TokenMap::insert_node_(const Name &n)
+{
+  // keep the load factor at or below one half
+  if ( 2 * (order_.size() + 1) > slots_.size() )
+    rehash_(slots_.empty() ? 8 : 2 * slots_.size());
+
+  Node *node = new Node(n, Token());
+
+  // keep order_ sorted, entries inserted in handle order are appended
+  size_t pos = order_.size();
+  if ( pos > 0 && order_.back()->value.first.toIndex() > n.toIndex() )
+    pos = std::upper_bound(order_.begin(), order_.end(), node, handle_less<Node>)
+          - order_.begin();
+  order_.insert(order_.begin() + pos, node);
+  renumber_(pos);
+
+  place_(node);
+  return node;
+}
+
+void TokenMap::remove_node_(Node *node)
+{
+  size_t hole = slot_(node->value.first.toIndex());
+  while ( slots_[hole].node != node )
+    hole = (hole + 1) & mask_;
+
+  // Shift following entries of the probe sequence back into the hole,
+  // unless that would move them before their home slot.
+  for ( size_t s = (hole + 1) & mask_ ; slots_[s].node != 0 ; s = (s + 1) & mask_ )
+  {
+    const size_t home = slot_(slots_[s].key);
+    if ( ((s - home) & mask_) >= ((s - hole) & mask_) )
+    {
+      slots_[hole] = slots_[s];
+      hole = s;
+    }
+  }
+  slots_[hole].node = 0;
+
+  const size_t pos = node->pos;
+  order_.erase(order_.begin() + pos);
+  renumber_(pos);
+
+  delete node;
+}
+
+void TokenMap::place_(Node *node)
+{
+  const Name::handle_t key = node->value.first.toIndex();
+  size_t s = slot_(key);
+  while ( slots_[s].node != 0 )
+    s = (s + 1) & mask_;
+  slots_[s].key = key;
+  slots_[s].node = node;
+}
+
+void TokenMap::renumber_(size_t from)
+{
+  for ( size_t k = from ; k < order_.size() ; ++k )
+    order_[k]->pos = k;
+}
+
+void TokenMap::rehash_(size_t n)
+{
+  const Slot empty = { 0, 0 };
+  slots_.assign(n, empty);
+  mask_ = n - 1;
+  shift_ = 32;
+  while ( n > 1 )
+  {
+    n >>= 1;
+    --shift_;
+  }
+  for ( size_t k = 0 ; k < order_.size() ; ++k )
+    place_(order_[k]);
+}
+
 const Token Dictionary::VoidToken;
 
 Dictionary::~Dictionary()
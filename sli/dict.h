@@ -28,15 +28,184 @@
 #include "name.h"
 #include "token.h"
 
+#include <algorithm>
 #include <map>
+#include <vector>
+#include <iterator>
 #include "sliexceptions.h"
 
 
-typedef  std::map<Name, Token, std::less<Name> > TokenMap;
+/**
+ * Hash table associating names with tokens.
+ *
+ * Entries are found through an open-addressing table with linear
+ * probing, keyed by the integer handle of the name. The handle is
+ * stored in the table itself, so that a lookup compares integers in
+ * contiguous memory and dereferences only the entry it finds.
+ *
+ * Each entry is allocated separately and keeps its address until it
+ * is erased. References to tokens in the map therefore stay valid
+ * across insertions, as they did for std::map; the cache of the
+ * dictionary stack relies on this.
+ *
+ * Iteration visits the entries in the order of their name handles,
+ * which is the order of std::map<Name, Token>. Two maps with the same
+ * names are thus always traversed in the same order. Insertion and
+ * erasure keep the entries sorted, so that iterating over a map does
+ * not modify it and several threads may iterate over the same const
+ * map. Iterators are invalidated by insertion and erasure.
+ */
+class TokenMap
+{
+public:
+  typedef Name key_type;
+  typedef Token mapped_type;
+  typedef std::pair<const Name, Token> value_type;
+  typedef size_t size_type;
+
+private:
+  struct Node
+  {
+    value_type value;
+    size_t pos;        //!< position of the node in order_
+
+    Node(const Name &n, const Token &t) : value(n, t), pos(0) {}
+  };
+
+  struct Slot
+  {
+    Name::handle_t key;
+    Node *node;        //!< NULL for empty slots
+  };
+
+public:
+  class const_iterator;
+
+  class iterator: public std::iterator<std::bidirectional_iterator_tag, value_type>
+  {
+    friend class TokenMap;
+    friend class const_iterator;
+    Node * const *p_;
+    explicit iterator(Node * const *p) : p_(p) {}
+  public:
+    iterator() : p_(0) {}
+    value_type& operator*() const { return (*p_)->value; }
+    value_type* operator->() const { return &(*p_)->value; }
+    iterator& operator++() { ++p_; return *this; }
+    iterator operator++(int) { iterator t(*this); ++p_; return t; }
+    iterator& operator--() { --p_; return *this; }
+    iterator operator--(int) { iterator t(*this); --p_; return t; }
+    bool operator==(const iterator &i) const { return p_ == i.p_; }
+    bool operator!=(const iterator &i) const { return p_ != i.p_; }
+  };
+
+  class const_iterator: public std::iterator<std::bidirectional_iterator_tag, const value_type>
+  {
+    friend class TokenMap;
+    Node * const *p_;
+    explicit const_iterator(Node * const *p) : p_(p) {}
+  public:
+    const_iterator() : p_(0) {}
+    const_iterator(const TokenMap::iterator &i) : p_(i.p_) {}
+    const value_type& operator*() const { return (*p_)->value; }
+    const value_type* operator->() const { return &(*p_)->value; }
+    const_iterator& operator++() { ++p_; return *this; }
+    const_iterator operator++(int) { const_iterator t(*this); ++p_; return t; }
+    const_iterator& operator--() { --p_; return *this; }
+    const_iterator operator--(int) { const_iterator t(*this); --p_; return t; }
+    friend bool operator==(const const_iterator &a, const const_iterator &b) { return a.p_ == b.p_; }
+    friend bool operator!=(const const_iterator &a, const const_iterator &b) { return a.p_ != b.p_; }
+  };
+
+  TokenMap() : slots_(), order_(), mask_(0), shift_(0) {}
+  TokenMap(const TokenMap &);
+  ~TokenMap();
+
+  TokenMap& operator=(const TokenMap &);
+
+  size_t size() const { return order_.size(); }
+  bool empty() const { return order_.empty(); }
+
+  iterator begin() { return iterator(first_()); }
+  iterator end() { return iterator(first_() + order_.size()); }
+  const_iterator begin() const { return const_iterator(first_()); }
+  const_iterator end() const { return const_iterator(first_() + order_.size()); }
+
+  iterator find(const Name &n)
+  {
+    Node *node = find_node_(n);
+    return node ? iterator(first_() + node->pos) : end();
+  }
+
+  const_iterator find(const Name &n) const
+  {
+    Node *node = find_node_(n);
+    return node ? const_iterator(first_() + node->pos) : end();
+  }
+
+  /**
+   * Return the token associated with n, inserting an empty token if
+   * n is not in the map.
+   */
+  Token& operator[](const Name &n)
+  {
+    Node *node = find_node_(n);
+    return node ? node->value.second : insert_node_(n)->value.second;
+  }
+
+  size_t erase(const Name &);
+  void erase(iterator);
+  void clear();
+
+protected:
+  /**
+   * Return a pointer to the token associated with n, or NULL if n is
+   * not in the map.
+   */
+  Token* find_token_(const Name &n) const
+  {
+    Node *node = find_node_(n);
+    return node ? &node->value.second : 0;
+  }
+
+private:
+  Node * const * first_() const
+  {
+    return order_.empty() ? 0 : &order_[0];
+  }
+
+  size_t slot_(Name::handle_t key) const
+  {
+    // Fibonacci hashing, spreads consecutive handles over the table
+    return static_cast<size_t>((key * 2654435769U) >> shift_);
+  }
+
+  Node* find_node_(const Name &n) const
+  {
+    if ( slots_.empty() )
+      return 0;
+    const Name::handle_t key = n.toIndex();
+    for ( size_t s = slot_(key) ; slots_[s].node != 0 ; s = (s + 1) & mask_ )
+      if ( slots_[s].key == key )
+        return slots_[s].node;
+    return 0;
+  }
+
+  Node* insert_node_(const Name &);
+  void remove_node_(Node *);
+  void place_(Node *);
+  void rehash_(size_t);
+  void renumber_(size_t);
+
+  std::vector<Slot> slots_;            //!< hash table, size is a power of two
+  std::vector<Node *> order_;  //!< entries, sorted by name handle
+  size_t mask_;                //!< slots_.size() - 1
+  unsigned int shift_;         //!< 32 - log2(slots_.size())
+};
 
 inline bool operator==(const TokenMap & x, const TokenMap &y)
 {
-  return (x.size() == y.size()) && equal(x.begin(), x.end(), y.begin());
+  return (x.size() == y.size()) && std::equal(x.begin(), x.end(), y.begin());
 }
 
 /** A class that associates names and tokens.
@@ -238,9 +407,9 @@ public:
 inline
 const Token& Dictionary::lookup(const Name &n) const
 {
-  TokenMap::const_iterator where = find(n);
-  if(where != end())
-    return (*where).second;
+  const Token *where = find_token_(n);
+  if(where != 0)
+    return *where;
   else
     return Dictionary::VoidToken;
 }
@@ -248,9 +417,9 @@ const Token& Dictionary::lookup(const Name &n) const
 inline
 const Token& Dictionary::lookup2(const Name &n) const
 {      
-  TokenMap::const_iterator where = find(n);
-  if(where != end())
-    return (*where).second;
+  const Token *where = find_token_(n);
+  if(where != 0)
+    return *where;
   else
     throw UndefinedName(n.toString());
 }
@@ -258,19 +427,15 @@ const Token& Dictionary::lookup2(const Name &n) const
 inline
 bool Dictionary::known(const Name &n) const
 {
-  TokenMap::const_iterator where = find(n);
-  if(where != end())
-    return true;
-  else
-    return false;
+  return find_token_(n) != 0;
 }
 
 inline
 bool Dictionary::known_but_not_accessed(const Name &n) const
 {
-  TokenMap::const_iterator where = find(n);
-  if(where != end())
-    return not where->second.accessed();
+  const Token *where = find_token_(n);
+  if(where != 0)
+    return not where->accessed();
   else
     return false;
 }
@@ -285,9 +450,9 @@ Token& Dictionary::insert(const Name &n, const Token &t)
 inline
 const Token& Dictionary::operator[](const Name &n) const
 {      
-  TokenMap::const_iterator where = find(n);
-  if(where != end())
-    return (*where).second;
+  const Token *where = find_token_(n);
+  if(where != 0)
+    return *where;
   else
     throw UndefinedName(n.toString());
 }
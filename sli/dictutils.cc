@@ -96,3 +96,47 @@ void accumulate_property(DictionaryDatum &d, Name propname, const std::vector<do
     std::transform((*arrd)->begin(), (*arrd)->end(), prop.begin(), (*arrd)->begin(), std::plus<double>());
   }
 }
+
+void accumulate_property(DictionaryDatum &d, Name propname, const std::vector<long> &prop)
+{
+  Token t = d->lookup2(propname);
+
+  IntVectorDatum* arrd = dynamic_cast<IntVectorDatum*>(t.datum());
+  assert(arrd != 0);
+
+  if ( (*arrd)->size() < prop.size() )
+    (*arrd)->resize(prop.size(), 0);
+
+  // add contents of prop to **arrd elementwise
+  std::transform(prop.begin(), prop.end(), (*arrd)->begin(), (*arrd)->begin(), std::plus<long>());
+}
+
+void move_property(DictionaryDatum &d, Name propname, std::vector<double> &prop)
+{
+  Token t = d->lookup2(propname);
+
+  DoubleVectorDatum* arrd = dynamic_cast<DoubleVectorDatum*>(t.datum());
+  assert(arrd != 0);
+
+  if ( (*arrd)->empty() ) // first data, hand over storage
+    (*arrd)->swap(prop);
+  else
+    (*arrd)->insert((*arrd)->end(), prop.begin(), prop.end());
+
+  prop.clear();
+}
+
+void move_property(DictionaryDatum &d, Name propname, std::vector<long> &prop)
+{
+  Token t = d->lookup2(propname);
+
+  IntVectorDatum* arrd = dynamic_cast<IntVectorDatum*>(t.datum());
+  assert(arrd != 0);
+
+  if ( (*arrd)->empty() ) // first data, hand over storage
+    (*arrd)->swap(prop);
+  else
+    (*arrd)->insert((*arrd)->end(), prop.begin(), prop.end());
+
+  prop.clear();
+}
@@ -337,6 +337,30 @@ void provide_property(DictionaryDatum&, Name, const std::vector<long>&);
  */
 void accumulate_property(DictionaryDatum&, Name, const std::vector<double>&);
 
+/** Add values of a vector<long> to a property IntVectorDatum in the dictionary.
+ * In contrast to the vector<double> variant, the vectors may differ in size;
+ * the property is extended with zeros if prop is longer. It is required for
+ * collecting histograms across threads when spike_detector is running in
+ * accumulation mode.
+ * @ingroup DictUtils
+ */
+void accumulate_property(DictionaryDatum&, Name, const std::vector<long>&);
+
+/** Move the contents of a vector<double> to a property DoubleVectorDatum in the dictionary.
+ * If the property is still empty, the storage of prop is handed over to the
+ * property without copying, otherwise prop is appended. In either case, prop
+ * is empty afterwards. This allows recording devices to pass on recorded data
+ * without copying it.
+ * @ingroup DictUtils
+ */
+void move_property(DictionaryDatum&, Name, std::vector<double>&);
+
+/** Move the contents of a vector<long> to a property IntVectorDatum in the dictionary.
+ * @see move_property(DictionaryDatum&, Name, std::vector<double>&)
+ * @ingroup DictUtils
+ */
+void move_property(DictionaryDatum&, Name, std::vector<long>&);
+
 #endif
 
 
@@ -118,6 +118,7 @@ SLIType SLIInterpreter::Iteratortype;
 DatatypeFunction         SLIInterpreter::datatypefunction;
 NametypeFunction         SLIInterpreter::nametypefunction;
 ProceduretypeFunction    SLIInterpreter::proceduretypefunction;
+CompiledproceduretypeFunction SLIInterpreter::compiledproceduretypefunction;
 LitproceduretypeFunction SLIInterpreter::litproceduretypefunction;
 FunctiontypeFunction     SLIInterpreter::functiontypefunction;
 TrietypeFunction         SLIInterpreter::trietypefunction;
@@ -478,6 +479,8 @@ SLIInterpreter::SLIInterpreter(void)
     dstack_name("dstack"),
     commandstring_name("moduleinitializers"),
     interpreter_name("SLIInterpreter::execute"),
+    exitcode_name("exitcode"),
+    exitcodes_name("exitcodes"),
 
     ArgumentTypeError("ArgumentType"),
     StackUnderflowError("StackUnderflow"),
@@ -1306,8 +1309,8 @@ int SLIInterpreter::execute_debug_(size_t exitlevel)
 int SLIInterpreter::execute_(size_t exitlevel)
 {
     int exitcode;
-    assert(statusdict->known("exitcodes"));
-    DictionaryDatum exitcodes = getValue<DictionaryDatum>(*statusdict, "exitcodes");
+    assert(statusdict->known(exitcodes_name));
+    DictionaryDatum exitcodes = getValue<DictionaryDatum>(*statusdict, exitcodes_name);
     
     if(SLIsignalflag !=0)
     {
@@ -1355,8 +1358,8 @@ int SLIInterpreter::execute_(size_t exitlevel)
 	terminate(exitcode);
     } 
     
-    assert(statusdict->known("exitcode"));
-    exitcode = getValue<long>(*statusdict,"exitcode");
+    assert(statusdict->known(exitcode_name));
+    exitcode = getValue<long>(*statusdict, exitcode_name);
     
     if (exitcode != 0)
 	errordict->insert(quitbyerror_name,baselookup(true_name));
@@ -147,6 +147,8 @@ public:
     Name dstack_name;
     Name commandstring_name;
     Name interpreter_name;
+    Name exitcode_name;
+    Name exitcodes_name;
 
     // Names of basic errors
     Name ArgumentTypeError;
@@ -222,6 +224,7 @@ public:
   static DatatypeFunction         datatypefunction;
   static NametypeFunction         nametypefunction;
   static ProceduretypeFunction    proceduretypefunction;
+  static CompiledproceduretypeFunction compiledproceduretypefunction;
   static LitproceduretypeFunction litproceduretypefunction;
   static FunctiontypeFunction     functiontypefunction;
   static TrietypeFunction         trietypefunction;
@@ -828,6 +831,15 @@ public:
       return cycle_count;
     }
 
+  /**
+   * Count a cycle which was executed outside the interpreter loop,
+   * e.g. by compiled code.
+   */
+  void inc_cycles(void)
+    {
+      ++cycle_count;
+    }
+
 
   template<class T>  void addmodule(void);
   void addmodule(SLIModule *);
@@ -22,8 +22,11 @@
 
 #include "name.h"
 
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
+#include <utility>
+#include <vector>
 
 
 std::size_t Name::capacity()
@@ -68,29 +71,93 @@ const std::string& Name::toString(void) const
 unsigned int Name::insert(const std::string &s)
 {
     Name::HandleMap_ &map=Name::handleMapInstance_();
-    Name::HandleMap_::const_iterator where=map.find(s);
+    handle_t handle;
 
-    if( where == map.end() )
+    if( !map.find(s, handle) )
     {
-	// The following is more comlex code than a simple
-	// handleMap_[s] = Handle(s), but it avoids the creation
-	// of spurious Handle objects. HEP 2007-05-24
 	HandleTable_ &table=Name::handleTableInstance_();
-	unsigned int newhandle= table.size();
-	map.insert(std::make_pair(s, newhandle));
+	handle = table.size();
 	table.push_back(s);
-	return newhandle;
+	map.insert(s, handle);
     }
-    else
-	return ((*where).second);
+    return handle;
+}
+
+size_t Name::HandleMap_::hash_(const std::string &s)
+{
+    // FNV-1a
+    size_t h = 2166136261U;
+    for ( std::string::const_iterator c = s.begin(); c != s.end(); ++c )
+    {
+	h ^= static_cast<unsigned char>(*c);
+	h *= 16777619U;
+    }
+    return h;
+}
+
+bool Name::HandleMap_::find(const std::string &s, handle_t &h) const
+{
+    if ( slots_.empty() )
+	return false;
+
+    const HandleTable_ &table=Name::handleTableInstance_();
+    const size_t hash = hash_(s);
+    const size_t mask = slots_.size() - 1;
+    for ( size_t k = hash & mask; slots_[k].handle != 0; k = (k + 1) & mask )
+	if ( slots_[k].hash == hash && table[slots_[k].handle - 1] == s )
+	{
+	    h = slots_[k].handle - 1;
+	    return true;
+	}
+    return false;
+}
+
+void Name::HandleMap_::insert(const std::string &s, handle_t h)
+{
+    // keep the load factor at or below one half
+    if ( 2 * (size_ + 1) > slots_.size() )
+	rehash_(slots_.empty() ? 1024 : 2 * slots_.size());
+
+    const size_t hash = hash_(s);
+    const size_t mask = slots_.size() - 1;
+    size_t k = hash & mask;
+    while ( slots_[k].handle != 0 )
+	k = (k + 1) & mask;
+    slots_[k].hash = hash;
+    slots_[k].handle = h + 1;
+    ++size_;
+}
+
+void Name::HandleMap_::rehash_(size_t n)
+{
+    std::vector<Slot> old(n);   // value-initialized, i.e., empty slots
+    old.swap(slots_);
+
+    const size_t mask = n - 1;
+    for ( size_t k = 0; k < old.size(); ++k )
+	if ( old[k].handle != 0 )
+	{
+	    size_t j = old[k].hash & mask;
+	    while ( slots_[j].handle != 0 )
+		j = (j + 1) & mask;
+	    slots_[j] = old[k];
+	}
 }
 
 void Name::list(std::ostream &out)
 {
-    Name::HandleMap_ &map=handleMapInstance_();
+    // The handle map is a hash table without order. List its content
+    // sorted by string, as the std::map it replaced did.
+    HandleTable_ &table=Name::handleTableInstance_();
+    std::vector<std::pair<std::string, handle_t> > entries;
+    entries.reserve(table.size());
+    for ( handle_t h = 0; h < table.size(); ++h )
+	entries.push_back(std::make_pair(table[h], h));
+    std::sort(entries.begin(), entries.end());
+
     out << "\nHandle Map content:" << std::endl;
-    for ( Name::HandleMap_::const_iterator where = map.begin(); 
-	  where != map.end(); ++where )
+    for ( std::vector<std::pair<std::string, handle_t> >::const_iterator where = entries.begin();
+	  where != entries.end(); ++where )
     {
 	out << (*where).first << " -> "
 	    << (*where).second
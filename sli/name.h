@@ -27,6 +27,7 @@
 #include <map>
 #include <string>
 #include <deque>
+#include <vector>
 #include <iostream>
 
 /**
@@ -100,8 +101,8 @@ class Name
   
   static bool lookup(const std::string &s)
   {
-    HandleMap_ &table=handleMapInstance_();
-    return (table.find(s) != table.end());
+    handle_t h;
+    return handleMapInstance_().find(s, h);
   }
   
   static
@@ -118,11 +119,40 @@ class Name
  private:
   handle_t insert(const std::string&);  
   
+  typedef std::deque<std::string> HandleTable_;
+
   /**
-   * Datatype for map from strings to handles. 
+   * Hash table mapping strings to handles.
+   * Open addressing with linear probing. Each slot stores the hash
+   * of the string and its handle plus one, zero marks empty slots.
+   * The strings themselves are only kept in the handle table.
    */
-  typedef std::map<std::string, handle_t> HandleMap_;
-  typedef std::deque<std::string> HandleTable_;
+  class HandleMap_
+  {
+  public:
+    HandleMap_() : slots_(), size_(0) {}
+
+    //! Return true and set h, if s has a handle.
+    bool find(const std::string &s, handle_t &h) const;
+
+    //! Enter s with handle h, s must not be in the map.
+    void insert(const std::string &s, handle_t h);
+
+  private:
+    struct Slot
+    {
+      size_t hash;
+      handle_t handle;
+    };
+
+    static size_t hash_(const std::string &);
+    void rehash_(size_t);
+
+    std::vector<Slot> slots_;
+    size_t size_;
+  };
+
+  friend class HandleMap_;
   
   /** 
    * Function returning a reference to the single map instance.
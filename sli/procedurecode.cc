@@ -0,0 +1,174 @@
+/*
+ *  procedurecode.cc
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "procedurecode.h"
+#include "interpret.h"
+#include "namedatum.h"
+#include "functiondatum.h"
+#include "triedatum.h"
+#include "psignal.h"
+
+ProcedureCode::ProcedureCode(SLIInterpreter *i, const TokenArray &a)
+  : code_(a.size()),
+    tokens_()
+{
+  tokens_.reserve(a.size());
+
+  for(size_t k=0; k<a.size(); ++k)
+  {
+    Instruction &ins=code_[k];
+    Datum *d=a[k].datum();
+    ins.token=a[k];
+
+    if(!d->is_executable())
+      ins.op=push;
+    else if(d->isoftype(SLIInterpreter::Nametype))
+    {
+      // Bind names like bind does, all other names are looked up
+      // at run time.
+      const Token &value=i->lookup(*static_cast<NameDatum *>(d));
+      if(!value.empty() && value->isoftype(SLIInterpreter::Functiontype))
+      {
+        ins.op=call;
+        ins.token=value;
+      }
+      else if(!value.empty() && value->isoftype(SLIInterpreter::Trietype))
+      {
+        ins.op=call_trie;
+        ins.token=value;
+      }
+      else
+        ins.op=lookup;
+    }
+    else if(d->isoftype(SLIInterpreter::Functiontype))
+      ins.op=call;
+    else if(d->isoftype(SLIInterpreter::Trietype))
+      ins.op=call_trie;
+    else if(d->isoftype(SLIInterpreter::Litproceduretype))
+    {
+      lockPTR<ProcedureCode> nested(new ProcedureCode(i,*static_cast<LitprocedureDatum *>(d)));
+      ins.op=push_proc;
+      ins.token=new CompiledProcedureDatum(nested);
+
+      LitprocedureDatum *lpd=new LitprocedureDatum(nested->tokens());
+      Token bound(lpd);
+      lpd->set_executable();
+      tokens_.push_back_move(bound);
+      continue;
+    }
+    else
+      ins.op=exec;
+
+    tokens_.push_back(ins.token);
+  }
+}
+
+bool ProcedureCode::execute(SLIInterpreter *i, long &pos) const
+{
+  // The frame of the running procedure. As long as a function leaves
+  // it unchanged, we continue with the next instruction.
+  const Datum *iterator=i->EStack.top().datum();
+  const Datum *counter=i->EStack.pick(1).datum();
+  const size_t load=i->EStack.load();
+  const long size=code_.size();
+
+  while(pos < size)
+  {
+    const Instruction &ins=code_[pos];
+    ++pos;
+
+    i->code_executed++;   // code coverage
+
+    switch(ins.op)
+    {
+    case push:
+    case push_proc:
+      // Copying a compiled procedure clones it, just like executing
+      // a literal procedure.
+      i->OStack.push(ins.token);
+      continue;
+
+    case call:
+      i->EStack.push(ins.token);
+      break;
+
+    case call_trie:
+      i->EStack.push(ins.token);
+      i->EStack.top().assign_by_ref(static_cast<TrieDatum *>(ins.token.datum())->lookup(i->OStack));
+      if(!i->EStack.top()->isoftype(SLIInterpreter::Functiontype))
+        return false;
+      break;
+
+    case lookup:
+    {
+      const Token &value=i->lookup(*static_cast<NameDatum *>(ins.token.datum()));
+      if(value.empty())
+      {
+        // Let the interpreter raise UndefinedName.
+        i->EStack.push(ins.token);
+        return false;
+      }
+      if(!value->is_executable())
+      {
+        i->OStack.push(value);
+        continue;
+      }
+      i->EStack.push(value);
+      if(!value->isoftype(SLIInterpreter::Functiontype))
+        return false;
+      break;
+    }
+
+    case exec:
+      i->EStack.push(ins.token);
+      return false;
+    }
+
+    // A function is on top of the execution stack.
+    if(SLIsignalflag != 0 || i->step_mode())
+      return false;
+
+    i->inc_cycles();
+    i->EStack.top()->execute(i);
+
+    if(i->EStack.load() != load
+       || i->EStack.top().datum() != iterator
+       || i->EStack.pick(1).datum() != counter)
+      return false;
+  }
+
+  return true;
+}
+
+CompiledProcedureDatum::CompiledProcedureDatum(const lockPTR<ProcedureCode> &code)
+  : ProcedureDatum(code->tokens()),
+    code_(code)
+{
+  set_executable();
+  action=&SLIInterpreter::compiledproceduretypefunction;
+}
+
+Token compile_procedure(SLIInterpreter *i, const TokenArray &a)
+{
+  lockPTR<ProcedureCode> code(new ProcedureCode(i,a));
+  return Token(new CompiledProcedureDatum(code));
+}
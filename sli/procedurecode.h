@@ -0,0 +1,130 @@
+/*
+ *  procedurecode.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef PROCEDURECODE_H
+#define PROCEDURECODE_H
+
+#include <vector>
+#include "arraydatum.h"
+#include "lockptr.h"
+
+/**
+ * Compiled code of a SLI procedure.
+ *
+ * The code has one instruction for each token of the procedure.
+ * Names which are bound to functions or tries at compile time are
+ * replaced by them, as with bind. All other names are looked up when
+ * the instruction is executed. Nested procedures are compiled
+ * recursively.
+ *
+ * execute() runs the instructions in a loop and calls functions
+ * directly, without returning to the interpreter cycle. As soon as a
+ * function leaves anything but the unchanged frame of the running
+ * procedure on the execution stack, e.g. because it runs a
+ * procedure, leaves a loop, or raises an error, execute() returns and
+ * the interpreter continues. Thus stop, stopped and the error
+ * handling behave exactly as for ordinary procedures.
+ */
+class ProcedureCode
+{
+public:
+  enum Opcode
+  {
+    push,      //!< push token to the operand stack
+    push_proc, //!< push copy of a compiled procedure to the operand stack
+    call,      //!< call function
+    call_trie, //!< call the variant of a trie matching the operand stack
+    lookup,    //!< look up name and execute its value
+    exec       //!< execute token in the interpreter cycle
+  };
+
+  /**
+   * Compile the tokens of a procedure, using the current dictionary
+   * context to bind names.
+   */
+  ProcedureCode(SLIInterpreter *, const TokenArray &);
+
+  /**
+   * The tokens of the compiled procedure, with bound names.
+   */
+  const TokenArray & tokens() const
+  {
+    return tokens_;
+  }
+
+  /**
+   * Execute instructions, starting at pos, as the procedure iterator
+   * on top of the execution stack. Returns true at the end of the
+   * code, false if the interpreter must continue.
+   */
+  bool execute(SLIInterpreter *, long &pos) const;
+
+private:
+  struct Instruction
+  {
+    Opcode op;
+    Token  token;
+  };
+
+  std::vector<Instruction> code_;
+  TokenArray tokens_;
+};
+
+/**
+ * Executable procedure with compiled code.
+ *
+ * A compiled procedure is a procedure in every respect, except that
+ * the procedure iterators run its code instead of its tokens (see
+ * iterate_procedure() in slibuiltins.cc). The action of the datum
+ * identifies it as compiled. If the tokens of a copy are changed,
+ * the copy is executed token by token.
+ */
+class CompiledProcedureDatum: public ProcedureDatum
+{
+  Datum * clone(void) const
+  {
+    return new CompiledProcedureDatum(*this);
+  }
+
+public:
+  CompiledProcedureDatum(const lockPTR<ProcedureCode> &);
+
+  /**
+   * Returns the code, or NULL if the tokens have been changed since
+   * compilation.
+   */
+  const ProcedureCode * code() const
+  {
+    return begin() == code_->tokens().begin() ? &*code_ : 0;
+  }
+
+private:
+  lockPTR<ProcedureCode> code_;
+};
+
+/**
+ * Return an executable procedure with the compiled code of the given
+ * tokens.
+ */
+Token compile_procedure(SLIInterpreter *, const TokenArray &);
+
+#endif
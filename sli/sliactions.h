@@ -49,6 +49,17 @@ ProceduretypeFunction() {}
     void execute(SLIInterpreter *) const;
 };
 
+/**
+ * Action of compiled procedures. Compiled procedures are executed
+ * like procedures, the action only serves to identify them.
+ * @see CompiledProcedureDatum
+ */
+class CompiledproceduretypeFunction : public ProceduretypeFunction
+{
+public:
+CompiledproceduretypeFunction() {}
+};
+
 class LitproceduretypeFunction : public SLIFunction
 {
 public:
@@ -31,6 +31,7 @@
 #include "stringdatum.h"
 #include "iteratordatum.h"
 #include "functiondatum.h"
+#include "procedurecode.h"
 
 void IlookupFunction::execute(SLIInterpreter *i) const
 {
@@ -60,6 +61,40 @@ void IiterateFunction::backtrace(SLIInterpreter *i, int p) const
   std::cerr << std::endl;
 }
 
+/**
+ * Execute the tokens of proc, starting at pos, until an executable
+ * token must be run by the interpreter. Compiled procedures run
+ * their code instead. Returns true at the end of the procedure and
+ * false if the interpreter must continue, in which case the frame
+ * of the caller may be gone.
+ */
+inline
+bool iterate_procedure(SLIInterpreter *i, ProcedureDatum const *proc, long &pos)
+{
+  if(proc->get_action() == &SLIInterpreter::compiledproceduretypefunction)
+  {
+    const ProcedureCode *code=static_cast<const CompiledProcedureDatum *>(proc)->code();
+    if(code != 0)
+      return code->execute(i,pos);
+  }
+
+  while(proc->index_is_valid(pos))
+  {
+    const Token &t=proc->get(pos);
+    ++pos;
+
+    i->code_executed++;   // code coverage
+
+    if(t->is_executable())
+    {
+      i->EStack.push(t);
+      return false;
+    }
+    i->OStack.push(t);
+  }
+  return true;
+}
+
 void IiterateFunction::execute(SLIInterpreter *i) const
 {
 /* 
@@ -79,20 +114,8 @@ void IiterateFunction::execute(SLIInterpreter *i) const
     ProcedureDatum const *pd= static_cast<ProcedureDatum *>(i->EStack.pick(2).datum());   
     long &pos=static_cast<IntegerDatum *>(i->EStack.pick(1).datum())->get();
 
-   while( pd->index_is_valid(pos))
-   {
-       const Token &t=pd->get(pos);
-       ++pos;
-  
-       i->code_executed++;   // code coverage 
-
-       if( t->is_executable())
-       {
-	   i->EStack.push(t);
-	   return;
-       }
-       i->OStack.push(t);
-   }
+    if(!iterate_procedure(i,pd,pos))
+      return;
    
    i->EStack.pop(3);
    i->dec_call_depth();
@@ -107,18 +130,8 @@ void IloopFunction::execute(SLIInterpreter *i) const
         const *proc= static_cast<ProcedureDatum *>(i->EStack.pick(2).datum()); 
     long &pos=static_cast<IntegerDatum *>(i->EStack.pick(1).datum())->get();
 
-    while( proc->index_is_valid(pos))
-    {
-	const Token &t(proc->get(pos));
-	++pos;
-	if( t->is_executable())
-	{
-	    i->EStack.push(t);
-	    return;
-	}
-
-	i->OStack.push(t);
-    }
+    if(!iterate_procedure(i,proc,pos))
+      return;
    
     pos =0;
 }
@@ -150,17 +163,8 @@ void IrepeatFunction::execute(SLIInterpreter *i) const
          *proc= static_cast<ProcedureDatum *>(i->EStack.pick(2).datum());
     
    long &pos=static_cast<IntegerDatum *>(i->EStack.pick(1).datum())->get();
-   while( proc->index_is_valid(pos))
-   {
-       const Token &t=proc->get(pos);
-       ++pos;
-       if( t->is_executable())
-       {
-	   i->EStack.push(t);
-	   return;
-       }
-       i->OStack.push(t);
-   }
+    if(!iterate_procedure(i,proc,pos))
+      return;
    
    long &lc=static_cast<IntegerDatum *>(i->EStack.pick(3).datum())->get();
    if( lc > 0 )
@@ -209,17 +213,8 @@ void IforFunction::execute(SLIInterpreter *i) const
     
     long &pos=proccount->get();
 
-    while( proc->index_is_valid(pos))
-    {
-	const Token &t= proc->get(pos);
-	++pos;
-	if( t->is_executable())
-	{
-	    i->EStack.push(t);
-	    return;
-	}
-	i->OStack.push(t);
-      }
+    if(!iterate_procedure(i,proc,pos))
+      return;
         
     IntegerDatum *count=
 	static_cast<IntegerDatum *>(i->EStack.pick(3).datum());
@@ -278,17 +273,8 @@ void IforallarrayFunction::execute(SLIInterpreter *i) const
  
     long &pos=proccount->get();
 
-    while( proc->index_is_valid(pos))
-    {
-	const Token &t= proc->get(pos);
-	++pos;
-	if( t->is_executable())
-	{
-	    i->EStack.push(t);
-	    return;
-	}
-	i->OStack.push(t);
-    }
+    if(!iterate_procedure(i,proc,pos))
+      return;
  
    IntegerDatum *count=
 	static_cast<IntegerDatum *>(i->EStack.pick(3).datum());
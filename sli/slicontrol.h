@@ -281,6 +281,13 @@ ExecFunction() {}
     void execute(SLIInterpreter *) const;
 };
 
+class CompileFunction: public SLIFunction
+{
+public:
+CompileFunction() {}
+    void execute(SLIInterpreter *) const;
+};
+
 
 class TypeinfoFunction: public SLIFunction
 {
@@ -20,9 +20,11 @@
  *
  */
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
+#include <vector>
 #include "slistartup.h"
 #include "interpret.h"
 #include "namedatum.h"
@@ -32,6 +34,8 @@
 #include "integerdatum.h"
 #include "booldatum.h"
 #include "dictdatum.h"
+#include "scanner.h"
+#include "parser.h"
 #include "config.h"
 
 extern int SLIsignalflag;
@@ -144,6 +148,150 @@ void SLIStartup::GetenvFunction::execute(SLIInterpreter *i) const
   i->EStack.pop();
 }
 
+/*BeginDocumentation
+Name: saveimage - write the precompiled token image of a SLI library directory
+
+Synopsis: (directory) saveimage -> n
+
+Description:
+saveimage parses all .sli files in the given directory and stores
+their tokens in the file sli-lib.image in the same directory. At
+startup, the interpreter loads the image of its library directory
+and runs the stored tokens instead of parsing the files. Entries are
+ignored if the source file has changed since the image was written,
+or if the image was written by a different version of NEST.
+
+Files that contain syntax errors are left out of the image.
+n is the number of files stored.
+
+The image is created by "make install". It has to be rebuilt after
+the library files are edited in place to keep the startup fast.
+
+Examples:
+statusdict/prgdatadir :: (/sli) join saveimage
+
+Author: NEST Initiative
+
+SeeAlso: run
+*/
+void SLIStartup::SaveimageFunction::execute(SLIInterpreter *i) const
+{
+  // string saveimage -> integer
+
+  i->assert_stack_load(1);
+
+  StringDatum *sd= dynamic_cast<StringDatum *>(i->OStack.top().datum());
+  assert(sd !=NULL);
+  const std::string dir = *sd;
+
+  DIR *dirptr = opendir(dir.c_str());
+  if ( dirptr == NULL )
+  {
+    i->raiseerror(i->BadIOError);
+    return;
+  }
+  std::vector<std::string> files;
+  dirent *entry;
+  while ( (entry = readdir(dirptr)) != NULL )
+  {
+    const std::string f(entry->d_name);
+    if ( f.size() > 4 && f.compare(f.size() - 4, 4, ".sli") == 0 )
+      files.push_back(f);
+  }
+  closedir(dirptr);
+  std::sort(files.begin(), files.end());
+
+  const long n = TokenImage::save(dir+"/"+imagefilename_, dir, files, *i->parse);
+  if ( n < 0 )
+  {
+    i->raiseerror(i->BadIOError);
+    return;
+  }
+
+  i->OStack.pop();
+  i->OStack.push(new IntegerDatum(n));
+  i->EStack.pop();
+}
+
+void SLIStartup::ImagetokensFunction::execute(SLIInterpreter *i) const
+{
+  // string array :imagetokens -> proc true
+  //                           -> false
+  // Resolves the file name like the file operator does and returns the
+  // precompiled tokens of the file, if the image has them.
+
+  i->assert_stack_load(2);
+
+  StringDatum *sd= dynamic_cast<StringDatum *>(i->OStack.pick(1).datum());
+  assert(sd !=NULL);
+  ArrayDatum *ad= dynamic_cast<ArrayDatum *>(i->OStack.top().datum());
+  assert(ad !=NULL);
+
+  std::string path;
+  if ( sd->find('/') != std::string::npos )
+    path = *sd;
+  else
+  {
+    for ( Token *p = ad->begin() ; p != ad->end() ; ++p )
+    {
+      StringDatum *dir = dynamic_cast<StringDatum *>(p->datum());
+      if ( dir == NULL )
+        continue;
+      const std::string candidate = *dir + "/" + *sd;
+      std::ifstream in(candidate.c_str());
+      if ( in )
+      {
+        path = candidate;
+        break;
+      }
+    }
+  }
+
+  Token proc;
+  i->OStack.pop(2);
+  if ( !path.empty() && image_.lookup(path, proc) )
+  {
+    i->OStack.push_move(proc);
+    i->OStack.push(i->baselookup(i->true_name));
+  }
+  else
+    i->OStack.push(i->baselookup(i->false_name));
+
+  i->EStack.pop();
+}
+
+void SLIStartup::ReadimageFunction::execute(SLIInterpreter *i) const
+{
+  // string :readimage -> proc true
+  //                   -> false
+  // Reads the image in the directory of the given file and returns the
+  // precompiled tokens of the file, if that image has them. Unlike
+  // :imagetokens, this does not use the image of the library directory
+  // loaded at startup, so that saveimage can be tested on any directory.
+
+  i->assert_stack_load(1);
+
+  StringDatum *sd= dynamic_cast<StringDatum *>(i->OStack.top().datum());
+  assert(sd !=NULL);
+  const std::string path = *sd;
+  const size_t sep = path.rfind('/');
+
+  TokenImage image;
+  Token proc;
+  i->OStack.pop();
+  if ( sep != std::string::npos
+       && image.load(path.substr(0, sep + 1) + imagefilename_)
+       && image.lookup(path, proc) )
+  {
+    i->OStack.push_move(proc);
+    i->OStack.push(i->baselookup(i->true_name));
+  }
+  else
+    i->OStack.push(i->baselookup(i->false_name));
+
+  i->EStack.pop();
+}
+
 /**
  * Checks if the environment variable envvar contains a directory. If yes, the
  * path is returned, else an empty string is returned.
@@ -192,6 +340,7 @@ std::string SLIStartup::checkenvpath(std::string const &envvar,
 
 SLIStartup::SLIStartup(int argc, char** argv)
 : startupfilename("sli-init.sli"),
+  imagefilename("sli-lib.image"),
   slilibpath("/sli"),
   slihomepath(PKGDATADIR),
   slidocdir(PKGDOCDIR),
@@ -214,6 +363,9 @@ SLIStartup::SLIStartup(int argc, char** argv)
   hostvendor_name("hostvendor"),
   hostcpu_name("hostcpu"),
   getenv_name("getenv"),
+  saveimage_name("saveimage"),
+  imagetokens_name(":imagetokens"),
+  readimage_name(":readimage"),
   statusdict_name("statusdict"),
   start_name("start"),
   intsize_name("int"),
@@ -240,7 +392,10 @@ SLIStartup::SLIStartup(int argc, char** argv)
   exitcode_exception_name("exception"),
   exitcode_fatal_name("fatal"),
   exitcode_unknownerror_name("unknownerror"),
-  environment_name("environment")
+  environment_name("environment"),
+  saveimagefunction(imagefilename),
+  imagetokensfunction(image_),
+  readimagefunction(imagefilename)
 {
   ArrayDatum ad;
 
@@ -310,6 +465,9 @@ void SLIStartup::init(SLIInterpreter *i)
   i->verbosity(verbosity_);
 
   i->createcommand(getenv_name,&getenvfunction);
+  i->createcommand(saveimage_name,&saveimagefunction);
+  i->createcommand(imagetokens_name,&imagetokensfunction);
+  i->createcommand(readimage_name,&readimagefunction);
   std::string fname;
 
   // Check for supplied SLIDATADIR
@@ -502,11 +660,20 @@ void SLIStartup::init(SLIInterpreter *i)
 
   if(!fname.empty())
   {
-    std::ifstream *input = new std::ifstream(fname.c_str());
-    Token input_token(new XIstreamDatum(input));
+    // Use the precompiled tokens of the startup file if they are up
+    // to date, otherwise parse the file.
+    Token proc;
+    image_.load(slihomepath+slilibpath+"/"+imagefilename);
+    if(image_.lookup(fname, proc))
+      i->EStack.push_move(proc);
+    else
+    {
+      std::ifstream *input = new std::ifstream(fname.c_str());
+      Token input_token(new XIstreamDatum(input));
             
-    i->EStack.push_move(input_token);
-    i->EStack.push(i->baselookup(i->iparse_name));
+      i->EStack.push_move(input_token);
+      i->EStack.push(i->baselookup(i->iparse_name));
+    }
   }
 
   // If we start with debug option, we set the debugging mode, but disable stepmode.
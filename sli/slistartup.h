@@ -30,6 +30,7 @@
 #include "slifunction.h"
 #include "name.h"
 #include "compose.hpp"
+#include "tokenimage.h"
 
 #include "dirent.h"
 #include "errno.h"
@@ -37,6 +38,7 @@
 class SLIStartup: public SLIModule
 {
   const std::string startupfilename;
+  const std::string imagefilename;
   const std::string slilibpath;
   std::string slihomepath;
   std::string slidocdir;
@@ -49,6 +51,7 @@ class SLIStartup: public SLIModule
   Token targs;
   int verbosity_;
   bool debug_;
+  TokenImage image_;
   public:
 
   Name argv_name;
@@ -70,6 +73,9 @@ class SLIStartup: public SLIModule
   Name hostcpu_name;
   
   Name getenv_name;
+  Name saveimage_name;
+  Name imagetokens_name;
+  Name readimage_name;
   Name statusdict_name;
   Name start_name;
 
@@ -109,7 +115,34 @@ class SLIStartup: public SLIModule
     void execute(SLIInterpreter *) const;
   };
 
+  class SaveimageFunction: public SLIFunction
+  {
+    const std::string &imagefilename_;
+    public:
+    SaveimageFunction(const std::string &f) : imagefilename_(f) {}
+    void execute(SLIInterpreter *) const;
+  };
+
+  class ImagetokensFunction: public SLIFunction
+  {
+    const TokenImage &image_;
+    public:
+    ImagetokensFunction(const TokenImage &image) : image_(image) {}
+    void execute(SLIInterpreter *) const;
+  };
+
+  class ReadimageFunction: public SLIFunction
+  {
+    const std::string &imagefilename_;
+    public:
+    ReadimageFunction(const std::string &f) : imagefilename_(f) {}
+    void execute(SLIInterpreter *) const;
+  };
+
   GetenvFunction getenvfunction;
+  SaveimageFunction saveimagefunction;
+  ImagetokensFunction imagetokensfunction;
+  ReadimageFunction readimagefunction;
 
   SLIStartup(int, char**);
   ~SLIStartup(){}
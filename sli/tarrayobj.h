@@ -111,21 +111,30 @@ class TokenArrayObj
       return refs_;
     }
 
+    // Atomic with --enable-atomic-refcount, like Datum::removeReference().
     unsigned int remove_reference()
     {
-      --refs_;
-      if(refs_==0)
+#ifdef SLI_ATOMIC_REFCOUNT
+      const unsigned int refs = __sync_sub_and_fetch(&refs_, 1);
+#else
+      const unsigned int refs = --refs_;
+#endif
+      if(refs==0)
 	{
 	  delete this;
 	  return 0;
 	}
       
-      return refs_;
+      return refs;
     }
 
     unsigned int add_reference()
     {
+#ifdef SLI_ATOMIC_REFCOUNT
+      return __sync_add_and_fetch(&refs_, 1);
+#else
       return ++refs_;
+#endif
     }
 
     void resize(size_t, size_t, const Token & = Token());
@@ -0,0 +1,425 @@
+/*
+ *  tokenimage.cc
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include "tokenimage.h"
+#include "interpret.h"
+#include "scanner.h"
+#include "parser.h"
+#include "arraydatum.h"
+#include "integerdatum.h"
+#include "doubledatum.h"
+#include "stringdatum.h"
+#include "namedatum.h"
+#include "config.h"
+
+/*
+  Layout of the image file:
+
+    magic        "SLIIMAGE"
+    format       uint32
+    version      string (PACKAGE_VERSION)
+    check        int64 and double, to detect foreign architectures
+    n_entries    uint32
+    n_entries x  name (string), size (uint64), mtime (int64),
+                 length (uint64), length bytes of tokens
+
+  The tokens of an entry are a uint32 count, followed by the
+  top-level tokens of the file. Each token is a one byte tag followed
+  by its value; procedures store their element count and elements.
+  Integers are written least significant byte first, doubles as their
+  in-memory representation.
+*/
+
+namespace
+{
+  const char image_magic[] = "SLIIMAGE";
+  const unsigned long image_format = 1;
+  const long check_integer = -1234567890L;
+  const double check_double = 0.1;
+
+  enum TokenTag
+  {
+    integer_tag = 'i',
+    double_tag = 'd',
+    string_tag = 's',
+    name_tag = 'n',
+    literal_tag = 'l',
+    procedure_tag = 'p'
+  };
+
+  class ImageWriter
+  {
+    std::string &out_;
+
+  public:
+    ImageWriter(std::string &out) : out_(out) {}
+
+    void uint(unsigned long v, size_t bytes)
+    {
+      for ( size_t k = 0 ; k < bytes ; ++k )
+      {
+        out_ += static_cast<char>(v & 0xff);
+        v >>= 8;
+      }
+    }
+
+    void real(double v)
+    {
+      out_.append(reinterpret_cast<const char*>(&v), sizeof(double));
+    }
+
+    void string(const std::string &s)
+    {
+      uint(s.size(), 4);
+      out_ += s;
+    }
+
+    // Returns false for tokens the parser does not produce.
+    bool token(const Token &t)
+    {
+      Datum *d = t.datum();
+      if ( d->isoftype(SLIInterpreter::Integertype) )
+      {
+        out_ += static_cast<char>(integer_tag);
+        uint(static_cast<unsigned long>(static_cast<IntegerDatum*>(d)->get()), 8);
+      }
+      else if ( d->isoftype(SLIInterpreter::Doubletype) )
+      {
+        out_ += static_cast<char>(double_tag);
+        real(static_cast<DoubleDatum*>(d)->get());
+      }
+      else if ( d->isoftype(SLIInterpreter::Stringtype) )
+      {
+        out_ += static_cast<char>(string_tag);
+        string(*static_cast<StringDatum*>(d));
+      }
+      else if ( d->isoftype(SLIInterpreter::Nametype) )
+      {
+        out_ += static_cast<char>(name_tag);
+        string(static_cast<NameDatum*>(d)->toString());
+      }
+      else if ( d->isoftype(SLIInterpreter::Literaltype) )
+      {
+        out_ += static_cast<char>(literal_tag);
+        string(static_cast<LiteralDatum*>(d)->toString());
+      }
+      else if ( d->isoftype(SLIInterpreter::Litproceduretype) )
+      {
+        const LitprocedureDatum *pd = static_cast<LitprocedureDatum*>(d);
+        out_ += static_cast<char>(procedure_tag);
+        uint(pd->size(), 4);
+        for ( size_t k = 0 ; k < pd->size() ; ++k )
+          if ( !token((*pd)[k]) )
+            return false;
+      }
+      else
+        return false;
+
+      return true;
+    }
+  };
+
+  class ImageReader
+  {
+    const std::string &in_;
+    size_t pos_;
+    size_t end_;
+
+  public:
+    ImageReader(const std::string &in, size_t pos, size_t end)
+      : in_(in), pos_(pos), end_(end) {}
+
+    size_t pos() const { return pos_; }
+
+    bool skip(size_t n)
+    {
+      if ( n > end_ - pos_ )
+        return false;
+      pos_ += n;
+      return true;
+    }
+
+    bool uint(unsigned long &v, size_t bytes)
+    {
+      if ( bytes > end_ - pos_ )
+        return false;
+      v = 0;
+      for ( size_t k = bytes ; k > 0 ; --k )
+        v = (v << 8) | static_cast<unsigned char>(in_[pos_ + k - 1]);
+      pos_ += bytes;
+      return true;
+    }
+
+    bool real(double &v)
+    {
+      if ( sizeof(double) > end_ - pos_ )
+        return false;
+      std::memcpy(&v, in_.data() + pos_, sizeof(double));
+      pos_ += sizeof(double);
+      return true;
+    }
+
+    bool string(std::string &s)
+    {
+      unsigned long n;
+      if ( !uint(n, 4) || n > end_ - pos_ )
+        return false;
+      s.assign(in_, pos_, n);
+      pos_ += n;
+      return true;
+    }
+
+    bool token(Token &t)
+    {
+      if ( pos_ == end_ )
+        return false;
+      const char tag = in_[pos_++];
+
+      unsigned long n;
+      double x;
+      std::string s;
+      switch ( tag )
+      {
+      case integer_tag:
+        if ( !uint(n, 8) )
+          return false;
+        t = new IntegerDatum(static_cast<long>(n));
+        return true;
+      case double_tag:
+        if ( !real(x) )
+          return false;
+        t = new DoubleDatum(x);
+        return true;
+      case string_tag:
+        if ( !string(s) )
+          return false;
+        t = new StringDatum(s);
+        return true;
+      case name_tag:
+        if ( !string(s) )
+          return false;
+        t = new NameDatum(Name(s));
+        return true;
+      case literal_tag:
+        if ( !string(s) )
+          return false;
+        t = new LiteralDatum(Name(s));
+        return true;
+      case procedure_tag:
+      {
+        LitprocedureDatum *pd = new LitprocedureDatum();
+        t = pd;
+        pd->set_executable();
+        return procedure(*pd);
+      }
+      default:
+        return false;
+      }
+    }
+
+    bool procedure(TokenArray &a)
+    {
+      unsigned long n;
+      if ( !uint(n, 4) )
+        return false;
+      a.reserve(n);
+      for ( unsigned long k = 0 ; k < n ; ++k )
+      {
+        Token t;
+        if ( !token(t) )
+          return false;
+        a.push_back_move(t);
+      }
+      return true;
+    }
+  };
+}
+
+TokenImage::TokenImage()
+  : dir_(),
+    entries_(),
+    data_()
+{}
+
+bool TokenImage::file_stat_(const std::string &path, unsigned long &size, long &mtime)
+{
+  struct stat st;
+  if ( stat(path.c_str(), &st) != 0 || !S_ISREG(st.st_mode) )
+    return false;
+  size = static_cast<unsigned long>(st.st_size);
+  mtime = static_cast<long>(st.st_mtime);
+  return true;
+}
+
+bool TokenImage::load(const std::string &filename)
+{
+  entries_.clear();
+  data_.clear();
+
+  std::ifstream in(filename.c_str(), std::ios::binary);
+  if ( !in )
+    return false;
+  std::ostringstream contents;
+  contents << in.rdbuf();
+  data_ = contents.str();
+
+  ImageReader r(data_, 0, data_.size());
+  const size_t magic_size = sizeof(image_magic) - 1;
+  if ( data_.compare(0, magic_size, image_magic) != 0 || !r.skip(magic_size) )
+    return false;
+
+  unsigned long format;
+  std::string version;
+  unsigned long check_i;
+  double check_d;
+  if ( !r.uint(format, 4) || format != image_format
+       || !r.string(version) || version != PACKAGE_VERSION
+       || !r.uint(check_i, 8) || static_cast<long>(check_i) != check_integer
+       || !r.real(check_d) || check_d != check_double )
+  {
+    data_.clear();
+    return false;
+  }
+
+  unsigned long n;
+  if ( !r.uint(n, 4) )
+    return false;
+
+  for ( unsigned long k = 0 ; k < n ; ++k )
+  {
+    std::string name;
+    Entry e;
+    unsigned long mtime;
+    unsigned long length;
+    if ( !r.string(name) || !r.uint(e.size, 8) || !r.uint(mtime, 8)
+         || !r.uint(length, 8) )
+      break;
+    e.mtime = static_cast<long>(mtime);
+    e.offset = r.pos();
+    e.length = length;
+    if ( !r.skip(length) )
+      break;
+    entries_[name] = e;
+  }
+
+  const size_t sep = filename.rfind('/');
+  dir_ = sep == std::string::npos ? std::string(".") : filename.substr(0, sep);
+
+  return true;
+}
+
+bool TokenImage::lookup(const std::string &path, Token &proc) const
+{
+  if ( entries_.empty() )
+    return false;
+
+  const size_t sep = path.rfind('/');
+  if ( sep == std::string::npos || path.compare(0, sep, dir_) != 0
+       || sep != dir_.size() )
+    return false;
+
+  std::map<std::string, Entry>::const_iterator it = entries_.find(path.substr(sep + 1));
+  if ( it == entries_.end() )
+    return false;
+
+  const Entry &e = it->second;
+  unsigned long size;
+  long mtime;
+  if ( !file_stat_(path, size, mtime) || size != e.size || mtime != e.mtime )
+    return false;
+
+  ProcedureDatum *pd = new ProcedureDatum();
+  Token t(pd);
+  ImageReader r(data_, e.offset, e.offset + e.length);
+  if ( !r.procedure(*pd) )
+    return false;
+  pd->set_executable();
+
+  proc.move(t);
+  return true;
+}
+
+long TokenImage::save(const std::string &filename,
+                      const std::string &dir,
+                      const std::vector<std::string> &files,
+                      Parser &parser)
+{
+  std::string out(image_magic);
+  ImageWriter w(out);
+  w.uint(image_format, 4);
+  w.string(PACKAGE_VERSION);
+  w.uint(static_cast<unsigned long>(check_integer), 8);
+  w.real(check_double);
+
+  std::string body;
+  long n = 0;
+  for ( std::vector<std::string>::const_iterator f = files.begin() ; f != files.end() ; ++f )
+  {
+    const std::string path = dir + "/" + *f;
+    unsigned long size;
+    long mtime;
+    if ( !file_stat_(path, size, mtime) )
+      continue;
+    std::ifstream in(path.c_str());
+    if ( !in )
+      continue;
+
+    std::string tokens;
+    ImageWriter tw(tokens);
+    unsigned long count = 0;
+    bool ok = true;
+    Token t;
+    while ( ok )
+    {
+      ok = parser.readToken(in, t);
+      if ( !ok || t.contains(parser.scan()->EndSymbol) )
+        break;
+      ok = tw.token(t);
+      ++count;
+    }
+    parser.clear_context();
+    if ( !ok )
+      continue;
+
+    ImageWriter bw(body);
+    bw.string(*f);
+    bw.uint(size, 8);
+    bw.uint(static_cast<unsigned long>(mtime), 8);
+    bw.uint(tokens.size() + 4, 8);
+    bw.uint(count, 4);
+    body += tokens;
+    ++n;
+  }
+  w.uint(n, 4);
+  out += body;
+
+  std::ofstream image(filename.c_str(), std::ios::binary | std::ios::trunc);
+  if ( !image || !image.write(out.data(), out.size()) )
+    return -1;
+
+  return n;
+}
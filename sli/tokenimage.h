@@ -0,0 +1,90 @@
+/*
+ *  tokenimage.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TOKENIMAGE_H
+#define TOKENIMAGE_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include "token.h"
+
+class Parser;
+
+/**
+ * Precompiled token image of the SLI library.
+ *
+ * The image stores the parsed top-level tokens of the .sli files in
+ * one directory, together with the size and modification time of each
+ * source file. Executing the stored tokens as a procedure is
+ * equivalent to running the file through iparse, but avoids scanning
+ * the source text at every interpreter startup.
+ *
+ * Entries are only used if the image was written by the same NEST
+ * version on the same architecture and the source file has not changed
+ * since. In all other cases, lookup() fails and the caller falls back
+ * to parsing the file.
+ */
+class TokenImage
+{
+public:
+  TokenImage();
+
+  /**
+   * Read the image file. Returns false if the file does not exist or
+   * was not written by this version of NEST.
+   */
+  bool load(const std::string &filename);
+
+  /**
+   * Create an executable procedure with the tokens of the given file.
+   * Returns false if the image has no up-to-date entry for the file.
+   */
+  bool lookup(const std::string &path, Token &proc) const;
+
+  /**
+   * Parse all given files in directory dir and write the image to
+   * filename. Files that cannot be parsed are left out. Returns the
+   * number of files stored, or -1 if the image could not be written.
+   */
+  static long save(const std::string &filename,
+                   const std::string &dir,
+                   const std::vector<std::string> &files,
+                   Parser &parser);
+
+private:
+  struct Entry
+  {
+    unsigned long size;
+    long mtime;
+    size_t offset;
+    size_t length;
+  };
+
+  static bool file_stat_(const std::string &, unsigned long &, long &);
+
+  std::string dir_;                       //!< directory of the source files
+  std::map<std::string, Entry> entries_;  //!< entries by file name
+  std::string data_;                      //!< contents of the image file
+};
+
+#endif
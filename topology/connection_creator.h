@@ -125,10 +125,86 @@ namespace nest
       std::vector<std::pair<Position<D>,index> >* positions_;
     };
 
+    /**
+     * Selects nodes from a masked pool with the probability given by the
+     * kernel, without visiting most of the nodes that are not selected.
+     *
+     * For each leaf of the Ntree, an upper bound p_max of the kernel is
+     * computed from the range of distances between the leaf and the
+     * anchor. Candidates are drawn with probability p_max by skipping a
+     * geometrically distributed number of nodes, and are accepted with
+     * probability p/p_max. In leaves completely inside the mask, skipped
+     * nodes are not visited at all. If the kernel provides no bound, every
+     * node is tested, as without sampler.
+     */
+    template <int D>
+    class KernelSampler_
+    {
+    public:
+      /**
+       * @param kernel  connection probability.
+       * @param layer   layer in which displacements are computed.
+       * @param anchor  position of the node to connect to or from.
+       * @param reverse if true, displacements point from the pool nodes
+       *                to the anchor, otherwise from the anchor to the
+       *                pool nodes.
+       * @param rng     random number generator to use.
+       */
+      KernelSampler_(const Parameter& kernel, const Layer<D>& layer,
+		     const Position<D>& anchor, bool reverse, librandom::RngPtr rng);
+
+      /**
+       * Advance iter to the next selected node, starting with the node
+       * iter points to. Leaves iter equal to end if no node is selected.
+       */
+      void select(typename Ntree<D,index>::masked_iterator& iter,
+		  const typename Ntree<D,index>::masked_iterator& end);
+
+      /**
+       * @returns displacement of the node selected last.
+       */
+      const Position<D>& displacement() const
+        { return disp_; }
+
+    private:
+      /**
+       * Compute the kernel bound for the leaf iter points into.
+       */
+      void enter_leaf_(const typename Ntree<D,index>::masked_iterator& iter);
+
+      /**
+       * @returns number of nodes to skip before the next candidate.
+       */
+      index draw_gap_();
+
+      const Parameter& kernel_;
+      const Layer<D>& layer_;
+      const Position<D> anchor_;
+      const bool reverse_;
+      librandom::RngPtr rng_;
+
+      const Ntree<D,index>* leaf_;   //!< leaf for which p_max_ is valid
+      double_t p_max_;               //!< kernel bound in leaf_, at most 1
+      double_t log_q_;               //!< log(1-p_max_)
+      index gap_;                    //!< nodes left to skip
+      bool new_gap_;                 //!< gap_ must be drawn before use
+      Position<D> disp_;
+    };
+
     template<typename Iterator, int D>
     void connect_to_target_(Iterator from, Iterator to, Node* tgt_ptr,  
 			    const Position<D>& tgt_pos, thread tgt_thread, const Layer<D>& source);
 
+    /**
+     * Connect sources inside the mask to the target with probability
+     * given by the kernel, using a KernelSampler_.
+     */
+    template<int D>
+    void connect_to_target_sampled_(typename Ntree<D,index>::masked_iterator from,
+				    typename Ntree<D,index>::masked_iterator to,
+				    Node* tgt_ptr, const Position<D>& tgt_pos,
+				    thread tgt_thread, const Layer<D>& source);
+
     template<int D>
     void target_driven_connect_(Layer<D>& source, Layer<D>& target);
 
@@ -153,6 +229,12 @@ namespace nest
     void get_parameters_(const Position<D> & pos, librandom::RngPtr rng, 
 			 double& weight, double& delay);
 
+    /**
+     * Number of sources for which connect_to_target_() evaluates the
+     * kernel at once.
+     */
+    static const size_t KERNEL_BLOCK_SIZE_ = 1024;
+
     ConnectionType type_;
     bool allow_autapses_;
     bool allow_multapses_;
@@ -24,6 +24,9 @@
 #define CONNECTION_CREATOR_IMPL_H
 
 #include <vector>
+#include <cmath>
+#include <limits>
+#include <algorithm>
 #ifdef _OPENMP
 #include <omp.h>
 #endif
@@ -80,22 +83,224 @@ namespace nest
   {
     librandom::RngPtr rng = net_.get_rng(tgt_thread);
 
-    const bool without_kernel = not kernel_.valid();
-    for ( Iterator iter = from ; iter != to ; ++iter )
+    if ( not kernel_.valid() )
     {
-      if ( (not allow_autapses_) and (iter->second == tgt_ptr->get_gid()) )
-	continue;
-
-      if ( without_kernel or
-	   rng->drand() < kernel_->value(source.compute_displacement(tgt_pos, iter->first), rng)
-	 ) 
+      for ( Iterator iter = from ; iter != to ; ++iter )
       {
+	if ( (not allow_autapses_) and (iter->second == tgt_ptr->get_gid()) )
+	  continue;
+
 	const Position<D> disp = source.compute_displacement(tgt_pos,iter->first);
 	connect_(iter->second, tgt_ptr, tgt_thread,
 		     weight_->value(disp, rng),
 		     delay_->value(disp, rng),
 		     synapse_model_);
       }
+      return;
+    }
+
+    // Evaluate the kernel for blocks of sources at once. Excluded
+    // autapses are left out, so that random kernels draw values only
+    // for candidate pairs.
+    std::vector<index> sources;
+    std::vector<Position<D> > displacements;
+    std::vector<double_t> probabilities;
+    sources.reserve(KERNEL_BLOCK_SIZE_);
+    displacements.reserve(KERNEL_BLOCK_SIZE_);
+
+    Iterator iter = from;
+    while ( iter != to )
+    {
+      sources.clear();
+      displacements.clear();
+      for ( ; iter != to and sources.size() < KERNEL_BLOCK_SIZE_ ; ++iter )
+      {
+	if ( (not allow_autapses_) and (iter->second == tgt_ptr->get_gid()) )
+	  continue;
+
+	sources.push_back(iter->second);
+	displacements.push_back(source.compute_displacement(tgt_pos, iter->first));
+      }
+
+      kernel_->values(displacements, rng, probabilities);
+
+      for ( size_t i = 0 ; i < sources.size() ; ++i )
+      {
+	if ( rng->drand() < probabilities[i] )
+	  connect_(sources[i], tgt_ptr, tgt_thread,
+		   weight_->value(displacements[i], rng),
+		   delay_->value(displacements[i], rng),
+		   synapse_model_);
+      }
+    }
+  }
+
+  template<int D>
+  void ConnectionCreator::connect_to_target_sampled_(typename Ntree<D,index>::masked_iterator from,
+						     typename Ntree<D,index>::masked_iterator to,
+						     Node* tgt_ptr, const Position<D>& tgt_pos,
+						     thread tgt_thread, const Layer<D>& source)
+  {
+    librandom::RngPtr rng = net_.get_rng(tgt_thread);
+
+    KernelSampler_<D> sampler(*kernel_, source, tgt_pos, false, rng);
+    for ( sampler.select(from, to) ; from != to ; ++from, sampler.select(from, to) )
+    {
+      // autapses are discarded after selection, this does not affect
+      // the probability of selecting any other source
+      if ( (not allow_autapses_) and (from->second == tgt_ptr->get_gid()) )
+	continue;
+
+      const Position<D>& disp = sampler.displacement();
+      connect_(from->second, tgt_ptr, tgt_thread,
+	       weight_->value(disp, rng),
+	       delay_->value(disp, rng),
+	       synapse_model_);
+    }
+  }
+
+  template <int D>
+  ConnectionCreator::KernelSampler_<D>::KernelSampler_(const Parameter& kernel, const Layer<D>& layer,
+						       const Position<D>& anchor, bool reverse,
+						       librandom::RngPtr rng):
+    kernel_(kernel),
+    layer_(layer),
+    anchor_(anchor),
+    reverse_(reverse),
+    rng_(rng),
+    leaf_(0),
+    p_max_(1.0),
+    log_q_(0.0),
+    gap_(0),
+    new_gap_(true),
+    disp_()
+  {}
+
+  template <int D>
+  void ConnectionCreator::KernelSampler_<D>::enter_leaf_(const typename Ntree<D,index>::masked_iterator& iter)
+  {
+    leaf_ = iter.leaf();
+
+    // Range of distances between anchor and leaf, taking into account
+    // periodic boundary conditions as in Layer::compute_displacement().
+    const Position<D>& ll = iter.leaf_lower_left();
+    const Position<D>& ext = iter.leaf_extent();
+    const Position<D>& layer_ext = layer_.get_extent();
+    const std::bitset<D> periodic = layer_.get_periodic_mask();
+
+    double_t r2_min = 0.0, r2_max = 0.0;
+    for ( int i = 0 ; i < D ; ++i )
+    {
+      double_t d_min, d_max;
+      if ( not periodic[i] )
+      {
+	const double_t lo = ll[i] - anchor_[i];
+	const double_t hi = lo + ext[i];
+	d_min = std::max(0.0, std::max(lo, -hi));
+	d_max = std::max(std::abs(lo), std::abs(hi));
+      }
+      else
+      {
+	const double_t L = layer_ext[i];
+	if ( ext[i] >= L )
+	{
+	  d_min = 0.0;
+	  d_max = 0.5*L;
+	}
+	else
+	{
+	  // leaf covers [a, b] relative to the anchor, modulo L
+	  double_t a = std::fmod(ll[i] - anchor_[i], L);
+	  if ( a < 0 )
+	    a += L;
+	  const double_t b = a + ext[i];
+	  d_min = b >= L ? 0.0 : std::min(a, L - b);
+	  if ( (a <= 0.5*L and 0.5*L <= b) or b >= 1.5*L )
+	    d_max = 0.5*L;
+	  else
+	    d_max = std::max(std::min(a, L - a),
+			     b < L ? std::min(b, L - b) : std::min(b - L, 2*L - b));
+	}
+      }
+      r2_min += d_min*d_min;
+      r2_max += d_max*d_max;
+    }
+
+    p_max_ = std::min(kernel_.max_value(std::sqrt(r2_min), std::sqrt(r2_max)), 1.0);
+    if ( p_max_ > 0.0 and p_max_ < 1.0 )
+      log_q_ = std::log(1.0 - p_max_);
+    new_gap_ = true;
+  }
+
+  template <int D>
+  index ConnectionCreator::KernelSampler_<D>::draw_gap_()
+  {
+    if ( p_max_ >= 1.0 )
+      return 0;
+    if ( not (p_max_ > 0.0) )
+      return std::numeric_limits<index>::max();
+
+    // number of failures before the first success with probability p_max_
+    const double_t gap = std::floor(std::log(1.0 - rng_->drand()) / log_q_);
+    if ( gap < static_cast<double_t>(std::numeric_limits<index>::max()) )
+      return static_cast<index>(gap);
+    return std::numeric_limits<index>::max();
+  }
+
+  template <int D>
+  void ConnectionCreator::KernelSampler_<D>::select(typename Ntree<D,index>::masked_iterator& iter,
+						    const typename Ntree<D,index>::masked_iterator& end)
+  {
+    while ( iter != end )
+    {
+      // The gap is redrawn when entering a new leaf. Since the number of
+      // nodes skipped is geometrically distributed, this does not bias
+      // the selection.
+      if ( iter.leaf() != leaf_ )
+	enter_leaf_(iter);
+
+      if ( new_gap_ )
+      {
+	gap_ = draw_gap_();
+	new_gap_ = false;
+      }
+
+      if ( gap_ > 0 )
+      {
+	if ( iter.leaf_inside() )
+	{
+	  const index remaining = iter.leaf_remaining();
+	  if ( gap_ <= remaining )
+	  {
+	    iter.skip_in_leaf(gap_);
+	    gap_ = 0;
+	  }
+	  else
+	  {
+	    iter.skip_in_leaf(remaining);
+	    ++iter;
+	    gap_ -= remaining + 1;
+	  }
+	}
+	else
+	{
+	  ++iter;
+	  --gap_;
+	}
+	continue;
+      }
+
+      // iter points to a candidate, accept with probability p/p_max_
+      if ( reverse_ )
+	disp_ = layer_.compute_displacement(iter->first, anchor_);
+      else
+	disp_ = layer_.compute_displacement(anchor_, iter->first);
+
+      new_gap_ = true;
+      if ( rng_->drand() * p_max_ < kernel_.value(disp_, rng_) )
+	return;
+
+      ++iter;
     }
   }
 
@@ -162,7 +367,8 @@ namespace nest
     // For each local target node:
     //  1. Apply Mask to source layer
     //  2. For each source node: Compute probability, draw random number, make
-    //     connection conditionally
+    //     connection conditionally. With mask and kernel, most sources that
+    //     are not connected are skipped (see KernelSampler_).
 
     // Nodes in the subnet are grouped by depth, so to select by depth, we
     // just adjust the begin and end pointers:
@@ -200,7 +406,10 @@ namespace nest
 
 	const Position<D> target_pos = target.get_position((*tgt_it)->get_subnet_index());
 
-	if ( mask_.valid() )
+	if ( mask_.valid() and kernel_.valid() )
+	  connect_to_target_sampled_(pool.masked_begin(target_pos), pool.masked_end(),
+				     *tgt_it, target_pos, target_thread, source);
+	else if ( mask_.valid() )
 	  connect_to_target_(pool.masked_begin(target_pos), pool.masked_end(), 
 			     *tgt_it, target_pos, target_thread, source);
 	else
@@ -255,16 +464,19 @@ namespace nest
         // outside the loop for efficiency.
         if (kernel_.valid()) {
 
-          for(typename Ntree<D,index>::masked_iterator iter=masked_layer.begin(target_pos); iter!=masked_layer.end(); ++iter) {
+          // Sources are selected by a KernelSampler_, autapses are
+          // discarded after selection.
+          KernelSampler_<D> sampler(*kernel_, target, target_pos, true, rng);
+          const typename Ntree<D,index>::masked_iterator end = masked_layer.end();
+          typename Ntree<D,index>::masked_iterator iter = masked_layer.begin(target_pos);
+          for(sampler.select(iter, end); iter!=end; ++iter, sampler.select(iter, end)) {
 
             if ((not allow_autapses_) and (iter->second == target_id))
               continue;
 
-            if (rng->drand() < kernel_->value(target.compute_displacement(iter->first, target_pos), rng)) {
-	      double w, d;
-              get_parameters_(target.compute_displacement(iter->first, target_pos), rng, w, d);
-              net_.connect(iter->second, *tgt_it, target_thread, synapse_model_, d, w);
-            }
+	    double w, d;
+            get_parameters_(sampler.displacement(), rng, w, d);
+            net_.connect(iter->second, *tgt_it, target_thread, synapse_model_, d, w);
 
           }
 
@@ -289,6 +501,9 @@ namespace nest
       // no mask
 
       std::vector<std::pair<Position<D>,index> >* positions = source.get_global_positions_vector(source_filter_);
+      std::vector<index> sources;
+      std::vector<Position<D> > displacements;
+      std::vector<double_t> probabilities;
       for (std::vector<Node*>::const_iterator tgt_it = target_begin;tgt_it != target_end;++tgt_it) {
 
         if (target_filter_.select_model() && ((*tgt_it)->get_model_id() != target_filter_.model))
@@ -304,15 +519,26 @@ namespace nest
         // outside the loop for efficiency.
         if (kernel_.valid()) {
 
+          // Evaluate the kernel for all sources at once, leaving out
+          // excluded autapses
+          sources.clear();
+          displacements.clear();
           for(typename std::vector<std::pair<Position<D>,index> >::iterator iter=positions->begin();iter!=positions->end();++iter) {
 
             if ((not allow_autapses_) and (iter->second == target_id))
               continue;
 
-            if (rng->drand() < kernel_->value(target.compute_displacement(iter->first,target_pos), rng)) {
+            sources.push_back(iter->second);
+            displacements.push_back(target.compute_displacement(iter->first,target_pos));
+          }
+          kernel_->values(displacements, rng, probabilities);
+
+          for(size_t i=0;i<sources.size();++i) {
+
+            if (rng->drand() < probabilities[i]) {
 	      double w,d;
-              get_parameters_(target.compute_displacement(iter->first,target_pos), rng, w, d);
-              net_.connect(iter->second, *tgt_it, target_thread, synapse_model_, d, w);
+              get_parameters_(displacements[i], rng, w, d);
+              net_.connect(sources[i], *tgt_it, target_thread, synapse_model_, d, w);
             }
           }
 
@@ -380,14 +606,15 @@ namespace nest
         // function using the Vose class.
         if (kernel_.valid()) {
 
-          std::vector<double_t> probabilities;
-
-          // Collect probabilities for the sources
+          // Collect probabilities for the sources, evaluating the kernel
+          // for all displacements at once
+          std::vector<Position<D> > displacements;
+          displacements.reserve(positions.size());
           for(typename std::vector<std::pair<Position<D>,index> >::iterator iter=positions.begin();iter!=positions.end();++iter) {
-
-              probabilities.push_back(kernel_->value(source.compute_displacement(target_pos,iter->first), rng));
-
+            displacements.push_back(source.compute_displacement(target_pos,iter->first));
           }
+          std::vector<double_t> probabilities;
+          kernel_->values(displacements, rng, probabilities);
 
           if ( positions.empty() or
               ((not allow_autapses_) and (positions.size()==1) and (positions[0].second==target_id)) or
@@ -418,7 +645,7 @@ namespace nest
               continue;
             }
 	    double w,d;
-            get_parameters_(source.compute_displacement(target_pos,positions[random_id].first), rng, w,d);
+            get_parameters_(displacements[random_id], rng, w,d);
 	    net_.connect(source_id, *tgt_it, target_thread, synapse_model_, d, w);
             is_selected[random_id] = true;
           }
@@ -485,12 +712,15 @@ namespace nest
         // function using the Vose class.
         if (kernel_.valid()) {
 
-          std::vector<double_t> probabilities;
-
-          // Collect probabilities for the sources
+          // Collect probabilities for the sources, evaluating the kernel
+          // for all displacements at once
+          std::vector<Position<D> > displacements;
+          displacements.reserve(positions->size());
           for(typename std::vector<std::pair<Position<D>,index> >::iterator iter=positions->begin();iter!=positions->end();++iter) {
-            probabilities.push_back(kernel_->value(source.compute_displacement(target_pos,iter->first), rng));
+            displacements.push_back(source.compute_displacement(target_pos,iter->first));
           }
+          std::vector<double_t> probabilities;
+          kernel_->values(displacements, rng, probabilities);
 
           // A Vose object draws random integers with a non-uniform
           // distribution.
@@ -514,9 +744,8 @@ namespace nest
               continue;
             }
 
-            Position<D> source_pos = (*positions)[random_id].first;
 	    double w,d;
-            get_parameters_(source.compute_displacement(target_pos,source_pos), rng, w,d);
+            get_parameters_(displacements[random_id], rng, w,d);
 	    net_.connect(source_id, *tgt_it, target_thread, synapse_model_, d, w);
             is_selected[random_id] = true;
           }
@@ -579,25 +808,24 @@ namespace nest
       std::vector<Position<D> > displacements;
       std::vector<double_t> probabilities;
 
-      // Find potential targets and probabilities
+      // Find potential targets
 
       for(typename Ntree<D,index>::masked_iterator tgt_it=masked_target.begin(source_pos); tgt_it!=masked_target.end(); ++tgt_it) {
 
         if ((not allow_autapses_) and (source_id == tgt_it->second))
           continue;
 
-        Position<D> target_displ = target.compute_displacement(source_pos, tgt_it->first);
-        librandom::RngPtr rng = net_.get_grng();
-
         targets.push_back(tgt_it->second);
-        displacements.push_back(target_displ);
-
-        if (kernel_.valid())
-          probabilities.push_back(kernel_->value(target_displ, rng));
-        else
-          probabilities.push_back(1.0);
+        displacements.push_back(target.compute_displacement(source_pos, tgt_it->first));
       }
 
+      // Probabilities, evaluating the kernel for all displacements at once
+      if (kernel_.valid()) {
+        librandom::RngPtr rng = net_.get_grng();
+        kernel_->values(displacements, rng, probabilities);
+      } else
+        probabilities.assign(targets.size(), 1.0);
+
       if ( targets.empty() or
           ((not allow_multapses_) and (targets.size()<number_of_connections_)) ) {
         std::string msg = String::compose("Global source ID %1: Not enough targets found", source_id);
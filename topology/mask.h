@@ -23,6 +23,8 @@
 #ifndef MASK_H
 #define MASK_H
 
+#include <vector>
+#include <algorithm>
 #include "nest.h"
 #include "topology_names.h"
 #include "position.h"
@@ -103,6 +105,16 @@ namespace nest
      */
     bool inside(const std::vector<double_t> &pt) const;
 
+    /**
+     * Test n points at once. The default implementation tests each point
+     * separately, masks override this to test all points in one loop.
+     * @param pos    array of n points.
+     * @param n      number of points.
+     * @param result array receiving n flags, non-zero for points inside
+     *               the mask.
+     */
+    virtual void inside(const Position<D> *pos, size_t n, char *result) const;
+
     /**
      * @returns true if the whole box is inside the mask.
      * @note a return value of false is not a guarantee that the whole box
@@ -153,6 +165,9 @@ namespace nest
     bool inside(const Position<D> &) const
       { return true; }
 
+    void inside(const Position<D> *, size_t n, char *result) const
+      { std::fill(result, result+n, 1); }
+
     /**
      * @returns true always for this mask
      */
@@ -202,6 +217,8 @@ namespace nest
      */
     bool inside(const Position<D> &p) const;
 
+    void inside(const Position<D> *pos, size_t n, char *result) const;
+
     /**
      * @returns true if the whole given box is inside this box
      */
@@ -260,6 +277,8 @@ namespace nest
      */
     bool inside(const Position<D> &p) const;
 
+    void inside(const Position<D> *pos, size_t n, char *result) const;
+
     /**
      * @returns true if the whole box is inside the circle
      */
@@ -313,6 +332,8 @@ namespace nest
 
     bool inside(const Position<D> &p) const;
 
+    void inside(const Position<D> *pos, size_t n, char *result) const;
+
     bool inside(const Box<D> &b) const;
 
     bool outside(const Box<D> &b) const;
@@ -352,6 +373,8 @@ namespace nest
 
     bool inside(const Position<D> &p) const;
 
+    void inside(const Position<D> *pos, size_t n, char *result) const;
+
     bool inside(const Box<D> &b) const;
 
     bool outside(const Box<D> &b) const;
@@ -391,6 +414,8 @@ namespace nest
 
     bool inside(const Position<D> &p) const;
 
+    void inside(const Position<D> *pos, size_t n, char *result) const;
+
     bool inside(const Box<D> &b) const;
 
     bool outside(const Box<D> &b) const;
@@ -426,6 +451,8 @@ namespace nest
 
     bool inside(const Position<D> &p) const;
 
+    void inside(const Position<D> *pos, size_t n, char *result) const;
+
     bool inside(const Box<D> &b) const;
 
     bool outside(const Box<D> &b) const;
@@ -461,6 +488,8 @@ namespace nest
 
     bool inside(const Position<D> &p) const;
 
+    void inside(const Position<D> *pos, size_t n, char *result) const;
+
     bool inside(const Box<D> &b) const;
 
     bool outside(const Box<D> &b) const;
@@ -64,6 +64,13 @@ namespace nest
     return inside(Position<D>(pt));
   }
 
+  template<int D>
+  void Mask<D>::inside(const Position<D> *pos, size_t n, char *result) const
+  {
+    for (size_t i=0; i<n; ++i)
+      result[i] = inside(pos[i]);
+  }
+
   template<int D>
   bool Mask<D>::outside(const Box<D> &b) const
   {
@@ -81,6 +88,17 @@ namespace nest
     return (p>=lower_left_) && (p<=upper_right_);
   }
 
+  template<int D>
+  void BoxMask<D>::inside(const Position<D> *pos, size_t n, char *result) const
+  {
+    for (size_t i=0; i<n; ++i) {
+      char in = 1;
+      for (int j=0; j<D; ++j)
+        in &= (pos[i][j]>=lower_left_[j]) & (pos[i][j]<=upper_right_[j]);
+      result[i] = in;
+    }
+  }
+
   template<int D>
   bool BoxMask<D>::inside(const Box<D> &b) const
   {
@@ -126,6 +144,19 @@ namespace nest
     return (p-center_).length() <= radius_;
   }
 
+  template<int D>
+  void BallMask<D>::inside(const Position<D> *pos, size_t n, char *result) const
+  {
+    // same arithmetic as inside(const Position<D>&), so that points on
+    // the boundary are classified identically
+    for (size_t i=0; i<n; ++i) {
+      double_t lensq = 0;
+      for (int j=0; j<D; ++j)
+        lensq += (pos[i][j]-center_[j])*(pos[i][j]-center_[j]);
+      result[i] = std::sqrt(lensq) <= radius_;
+    }
+  }
+
   template<>
   bool BallMask<2>::inside(const Box<2> &b) const
   {
@@ -173,14 +204,16 @@ namespace nest
   template<int D>
   bool BallMask<D>::outside(const Box<D> &b) const
   {
-    // Currently only checks if the box is outside the bounding box of
-    // the ball. This could be made more refined.
+    // The box is outside if the point of the box closest to the center
+    // is outside the ball.
+    Position<D> closest = center_;
     for (int i=0; i<D; ++i) {
-      if ((b.upper_right[i] < center_[i]-radius_) ||
-          (b.lower_left[i] > center_[i]+radius_))
-        return true;
+      if (closest[i] < b.lower_left[i])
+        closest[i] = b.lower_left[i];
+      else if (closest[i] > b.upper_right[i])
+        closest[i] = b.upper_right[i];
     }
-    return false;
+    return not inside(closest);
   }
 
   template<int D>
@@ -217,6 +250,16 @@ namespace nest
     return mask1_->inside(p) && mask2_->inside(p);
   }
 
+  template<int D>
+  void IntersectionMask<D>::inside(const Position<D> *pos, size_t n, char *result) const
+  {
+    std::vector<char> result2(n);
+    mask1_->inside(pos,n,result);
+    mask2_->inside(pos,n,&result2[0]);
+    for (size_t i=0; i<n; ++i)
+      result[i] &= result2[i];
+  }
+
   template<int D>
   bool IntersectionMask<D>::inside(const Box<D> &b) const
   {
@@ -255,6 +298,16 @@ namespace nest
     return mask1_->inside(p) || mask2_->inside(p);
   }
 
+  template<int D>
+  void UnionMask<D>::inside(const Position<D> *pos, size_t n, char *result) const
+  {
+    std::vector<char> result2(n);
+    mask1_->inside(pos,n,result);
+    mask2_->inside(pos,n,&result2[0]);
+    for (size_t i=0; i<n; ++i)
+      result[i] |= result2[i];
+  }
+
   template<int D>
   bool UnionMask<D>::inside(const Box<D> &b) const
   {
@@ -293,6 +346,16 @@ namespace nest
     return mask1_->inside(p) && !mask2_->inside(p);
   }
 
+  template<int D>
+  void DifferenceMask<D>::inside(const Position<D> *pos, size_t n, char *result) const
+  {
+    std::vector<char> result2(n);
+    mask1_->inside(pos,n,result);
+    mask2_->inside(pos,n,&result2[0]);
+    for (size_t i=0; i<n; ++i)
+      result[i] &= !result2[i];
+  }
+
   template<int D>
   bool DifferenceMask<D>::inside(const Box<D> &b) const
   {
@@ -323,6 +386,15 @@ namespace nest
     return m_->inside(-p);
   }
 
+  template<int D>
+  void ConverseMask<D>::inside(const Position<D> *pos, size_t n, char *result) const
+  {
+    std::vector<Position<D> > reversed(n);
+    for (size_t i=0; i<n; ++i)
+      reversed[i] = -pos[i];
+    m_->inside(&reversed[0],n,result);
+  }
+
   template<int D>
   bool ConverseMask<D>::inside(const Box<D> &b) const
   {
@@ -354,6 +426,15 @@ namespace nest
     return m_->inside(p-anchor_);
   }
 
+  template<int D>
+  void AnchoredMask<D>::inside(const Position<D> *pos, size_t n, char *result) const
+  {
+    std::vector<Position<D> > shifted(pos,pos+n);
+    for (size_t i=0; i<n; ++i)
+      shifted[i] -= anchor_;
+    m_->inside(&shifted[0],n,result);
+  }
+
   template<int D>
   bool AnchoredMask<D>::inside(const Box<D> &b) const
   {
@@ -130,7 +130,7 @@ namespace nest
       /**
        * Initialize an invalid iterator.
        */
-      masked_iterator() : ntree_(0), top_(0), allin_top_(0), node_(0), mask_(0) {}
+      masked_iterator() : ntree_(0), top_(0), allin_top_(0), node_(0), mask_(0), masked_leaf_(0) {}
 
       /**
        * Initialize an iterator to point to the first leaf node inside the
@@ -167,6 +167,48 @@ namespace nest
       bool operator!=(const masked_iterator &other) const
         { return (other.ntree_!=ntree_) || (other.node_!=node_); }
 
+      /**
+       * @returns the leaf containing the current node.
+       */
+      const Ntree * leaf() const
+        { return ntree_; }
+
+      /**
+       * @returns lower left corner of the current leaf.
+       */
+      const Position<D> & leaf_lower_left() const
+        { return ntree_->lower_left_; }
+
+      /**
+       * @returns extent of the current leaf.
+       */
+      const Position<D> & leaf_extent() const
+        { return ntree_->extent_; }
+
+      /**
+       * @returns true if the current leaf is completely inside the mask.
+       */
+      bool leaf_inside() const
+        { return allin_top_ != 0; }
+
+      /**
+       * @returns the number of nodes following the current node in the
+       * current leaf.
+       */
+      index leaf_remaining() const
+        { return ntree_->nodes_.size() - node_ - 1; }
+
+      /**
+       * Skip n nodes within the current leaf. Only valid if the leaf is
+       * completely inside the mask and n <= leaf_remaining().
+       */
+      void skip_in_leaf(index n)
+        {
+          assert(allin_top_ != 0);
+          assert(node_ + n < ntree_->nodes_.size());
+          node_ += n;
+        }
+
     protected:
 
       /**
@@ -196,6 +238,12 @@ namespace nest
        */
       void next_anchor_();
 
+      /**
+       * @returns true if the current node is inside the mask. All nodes
+       * of a leaf are tested at once when the leaf is first visited.
+       */
+      bool node_inside_();
+
       Ntree *ntree_;
       Ntree *top_;
       Ntree *allin_top_;
@@ -204,6 +252,9 @@ namespace nest
       Position<D> anchor_;
       std::vector<Position<D> > anchors_;
       index current_anchor_;
+      const Ntree *masked_leaf_;     ///< leaf tested in leaf_mask_
+      index masked_anchor_;          ///< anchor used for leaf_mask_
+      std::vector<char> leaf_mask_;  ///< flags for nodes of masked_leaf_
     };
 
     /**
@@ -294,6 +345,12 @@ namespace nest
      */
     void append_nodes_(std::vector<value_type>&, const Mask<D> &, const Position<D> &);
 
+    /**
+     * Test all nodes of this leaf against the mask at once.
+     * @param result receives one flag per node, non-zero if inside.
+     */
+    void mask_nodes_(const Mask<D> &, const Position<D> &anchor, std::vector<char> &result) const;
+
     /**
      * @returns the subquad number for this position
      */
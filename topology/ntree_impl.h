@@ -101,7 +101,8 @@ namespace nest {
 
   template<int D, class T, int max_capacity, int max_depth>
   Ntree<D,T,max_capacity,max_depth>::masked_iterator::masked_iterator(Ntree<D,T,max_capacity,max_depth>& q, const Mask<D> &mask, const Position<D> &anchor):
-    ntree_(&q), top_(&q), allin_top_(0), node_(0), mask_(&mask), anchor_(anchor), anchors_(), current_anchor_(0)
+    ntree_(&q), top_(&q), allin_top_(0), node_(0), mask_(&mask), anchor_(anchor), anchors_(), current_anchor_(0),
+    masked_leaf_(0), masked_anchor_(0), leaf_mask_()
   {
     if (ntree_->periodic_.any()) {
       Box<D> mask_bb = mask_->get_bbox();
@@ -158,7 +159,7 @@ namespace nest {
         first_leaf_();
       }
 
-      if ( ntree_->nodes_.empty() || (!mask_->inside(ntree_->nodes_[node_].first-anchor_))) {
+      if ( ntree_->nodes_.empty() || (!node_inside_())) {
         ++(*this);
       }
     }
@@ -289,7 +290,7 @@ namespace nest {
     node_++;
 
     if (allin_top_ == 0) {
-      while((node_ < ntree_->nodes_.size()) && (!mask_->inside(ntree_->nodes_[node_].first-anchor_))) {
+      while((node_ < ntree_->nodes_.size()) && (!node_inside_())) {
         node_++;
       }
     }
@@ -303,7 +304,7 @@ namespace nest {
       if (ntree_ == 0) break;
 
       if (allin_top_ == 0) {
-        while((node_ < ntree_->nodes_.size()) && (!mask_->inside(ntree_->nodes_[node_].first-anchor_))) {
+        while((node_ < ntree_->nodes_.size()) && (!node_inside_())) {
           node_++;
         }
       }
@@ -312,6 +313,35 @@ namespace nest {
     return *this;
   }
 
+  template<int D, class T, int max_capacity, int max_depth>
+  bool Ntree<D,T,max_capacity,max_depth>::masked_iterator::node_inside_()
+  {
+    if (allin_top_)
+      return true;
+
+    if ((masked_leaf_ != ntree_) || (masked_anchor_ != current_anchor_)) {
+      ntree_->mask_nodes_(*mask_, anchor_, leaf_mask_);
+      masked_leaf_ = ntree_;
+      masked_anchor_ = current_anchor_;
+    }
+
+    return leaf_mask_[node_];
+  }
+
+  template<int D, class T, int max_capacity, int max_depth>
+  void Ntree<D,T,max_capacity,max_depth>::mask_nodes_(const Mask<D> &mask, const Position<D> &anchor, std::vector<char> &result) const
+  {
+    const size_t n = nodes_.size();
+    result.resize(n);
+    if (n == 0)
+      return;
+
+    std::vector<Position<D> > shifted(n);
+    for (size_t i=0; i<n; ++i)
+      shifted[i] = nodes_[i].first - anchor;
+    mask.inside(&shifted[0], n, &result[0]);
+  }
+
   template<int D, class T, int max_capacity, int max_depth>
   int Ntree<D,T,max_capacity,max_depth>::subquad_(const Position<D>& pos)
   {
@@ -344,10 +374,11 @@ namespace nest {
 
     if (leaf_) {
 
-      for(typename std::vector<std::pair<Position<D>,T> >::iterator i=nodes_.begin();
-          i!=nodes_.end(); ++i) {
-        if (mask.inside(i->first - anchor))
-          v.push_back(*i);
+      std::vector<char> in;
+      mask_nodes_(mask, anchor, in);
+      for(size_t i=0; i<nodes_.size(); ++i) {
+        if (in[i])
+          v.push_back(nodes_[i]);
       }
 
     } else {
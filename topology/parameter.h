@@ -24,6 +24,9 @@
 #define PARAMETER_H
 
 #include <limits>
+#include <vector>
+#include <cmath>
+#include <algorithm>
 #include "nest.h"
 #include "randomgen.h"
 #include "nest_names.h"
@@ -123,6 +126,81 @@ namespace nest
      */
     double_t value(const std::vector<double_t> &pt, librandom::RngPtr& rng) const;
 
+    /**
+     * Evaluate the parameter at n points.
+     * @param pos  array of n points.
+     * @param n    number of points.
+     * @param rng  random number generator.
+     * @param vals array receiving the n values.
+     */
+    template<int D>
+    void values(const Position<D> *pos, size_t n, librandom::RngPtr& rng,
+                double_t *vals) const
+      {
+        if (n == 0)
+          return;
+        raw_values(pos,n,rng,vals);
+        for (size_t i=0; i<n; ++i)
+          if (vals[i]<cutoff_)
+            vals[i] = 0.0;
+      }
+
+    /**
+     * Evaluate the parameter at all points in pos.
+     * @param vals is resized to the number of points.
+     */
+    template<int D>
+    void values(const std::vector<Position<D> > &pos, librandom::RngPtr& rng,
+                std::vector<double_t> &vals) const
+      {
+        vals.resize(pos.size());
+        if (not pos.empty())
+          values(&pos[0],pos.size(),rng,&vals[0]);
+      }
+
+    /**
+     * Raw values disregarding cutoff. The default implementation calls
+     * raw_value() for each point, parameters override this to evaluate
+     * all points in a single loop.
+     */
+    virtual void raw_values(const Position<2> *pos, size_t n,
+                            librandom::RngPtr& rng, double_t *vals) const
+      {
+        for (size_t i=0; i<n; ++i)
+          vals[i] = raw_value(pos[i],rng);
+      }
+
+    virtual void raw_values(const Position<3> *pos, size_t n,
+                            librandom::RngPtr& rng, double_t *vals) const
+      {
+        for (size_t i=0; i<n; ++i)
+          vals[i] = raw_value(pos[i],rng);
+      }
+
+    /**
+     * @returns an upper bound for the value of the parameter at any
+     * displacement with length between r_min and r_max, or infinity if
+     * no bound is known.
+     */
+    double_t max_value(double_t r_min, double_t r_max) const
+      {
+        const double_t val = raw_max_value(r_min,r_max);
+        if (val<cutoff_)
+          return 0.0;
+        else if (cutoff_ > -std::numeric_limits<double>::infinity())
+          return std::max(val, 0.0);  // values below cutoff are set to zero
+        else
+          return val;
+      }
+
+    /**
+     * Upper bound disregarding cutoff.
+     * @returns an upper bound for the raw value of the parameter at any
+     * displacement with length between r_min and r_max.
+     */
+    virtual double_t raw_max_value(double_t, double_t) const
+      { return std::numeric_limits<double>::infinity(); }
+
     /**
      * Clone method.
      * @returns dynamically allocated copy of parameter object
@@ -185,6 +263,14 @@ namespace nest
     double_t raw_value(const Position<3> &, librandom::RngPtr&) const
       { return value_; }
 
+    void raw_values(const Position<2> *, size_t n, librandom::RngPtr&, double_t *vals) const
+      { std::fill(vals, vals+n, value_); }
+    void raw_values(const Position<3> *, size_t n, librandom::RngPtr&, double_t *vals) const
+      { std::fill(vals, vals+n, value_); }
+
+    double_t raw_max_value(double_t, double_t) const
+      { return value_; }
+
     Parameter * clone() const
       { return new ConstantParameter(value_); }
 
@@ -209,11 +295,33 @@ namespace nest
 
     virtual double_t raw_value(double_t) const = 0;
 
+    /**
+     * Raw values for n distances. May be called with vals == r.
+     */
+    virtual void raw_values(const double_t *r, size_t n, double_t *vals) const
+      {
+        for (size_t i=0; i<n; ++i)
+          vals[i] = raw_value(r[i]);
+      }
+
     double_t raw_value(const Position<2> &p, librandom::RngPtr&) const
       { return raw_value(p.length()); }
     double_t raw_value(const Position<3> &p, librandom::RngPtr&) const
       { return raw_value(p.length()); }
 
+    void raw_values(const Position<2> *pos, size_t n, librandom::RngPtr&, double_t *vals) const
+      {
+        for (size_t i=0; i<n; ++i)
+          vals[i] = pos[i].length();
+        raw_values(vals,n,vals);
+      }
+    void raw_values(const Position<3> *pos, size_t n, librandom::RngPtr&, double_t *vals) const
+      {
+        for (size_t i=0; i<n; ++i)
+          vals[i] = pos[i].length();
+        raw_values(vals,n,vals);
+      }
+
   };
 
   /**
@@ -241,6 +349,17 @@ namespace nest
         return a_*x + c_;
       }
 
+    void raw_values(const double_t *r, size_t n, double_t *vals) const
+      {
+        for (size_t i=0; i<n; ++i)
+          vals[i] = a_*r[i] + c_;
+      }
+
+    double_t raw_max_value(double_t r_min, double_t r_max) const
+      {
+        return std::max(a_*r_min, a_*r_max) + c_;
+      }
+
     Parameter * clone() const
       { return new LinearParameter(*this); }
 
@@ -280,6 +399,18 @@ namespace nest
         return c_ + a_*std::exp(-x/tau_);
       }
 
+    void raw_values(const double_t *r, size_t n, double_t *vals) const
+      {
+        const double_t inv_tau = 1.0/tau_;
+        for (size_t i=0; i<n; ++i)
+          vals[i] = c_ + a_*std::exp(-r[i]*inv_tau);
+      }
+
+    double_t raw_max_value(double_t r_min, double_t r_max) const
+      {
+        return c_ + std::max(a_*std::exp(-r_min/tau_), a_*std::exp(-r_max/tau_));
+      }
+
     Parameter * clone() const
       { return new ExponentialParameter(*this); }
 
@@ -323,6 +454,24 @@ namespace nest
           std::exp(-std::pow(x - mean_,2)/(2*std::pow(sigma_,2)));
       }
 
+    void raw_values(const double_t *r, size_t n, double_t *vals) const
+      {
+        const double_t inv_two_sigma2 = 1.0/(2*sigma_*sigma_);
+        for (size_t i=0; i<n; ++i)
+          vals[i] = c_ + p_center_*std::exp(-(r[i]-mean_)*(r[i]-mean_)*inv_two_sigma2);
+      }
+
+    double_t raw_max_value(double_t r_min, double_t r_max) const
+      {
+        // closest distance to mean for a peak, farthest for a trough
+        double_t x;
+        if (p_center_ >= 0)
+          x = std::min(std::max(mean_, r_min), r_max);
+        else
+          x = (mean_ - r_min > r_max - mean_) ? r_min : r_max;
+        return raw_value(x);
+      }
+
     Parameter * clone() const
       { return new GaussianParameter(*this); }
 
@@ -366,10 +515,29 @@ namespace nest
         return raw_value(Position<2>(pos[0],pos[1]),rng);
       }
 
+    void raw_values(const Position<2> *pos, size_t n, librandom::RngPtr&, double_t *vals) const
+      { raw_values_(pos,n,vals); }
+    void raw_values(const Position<3> *pos, size_t n, librandom::RngPtr&, double_t *vals) const
+      { raw_values_(pos,n,vals); }
+
     Parameter * clone() const
       { return new Gaussian2DParameter(*this); }
 
   private:
+    template<int D>
+    void raw_values_(const Position<D> *pos, size_t n, double_t *vals) const
+      {
+        const double_t ax = 1.0/(sigma_x_*sigma_x_);
+        const double_t ay = 1.0/(sigma_y_*sigma_y_);
+        const double_t axy = 2.*rho_/(sigma_x_*sigma_y_);
+        const double_t scale = -1.0/(2.*(1.-rho_*rho_));
+        for (size_t i=0; i<n; ++i) {
+          const double_t dx = pos[i][0]-mean_x_;
+          const double_t dy = pos[i][1]-mean_y_;
+          vals[i] = c_ + p_center_*std::exp(scale*(dx*dx*ax + dy*dy*ay - dx*dy*axy));
+        }
+      }
+
     double_t c_, p_center_, mean_x_, sigma_x_, mean_y_, sigma_y_, rho_;
   };
 
@@ -410,10 +578,24 @@ namespace nest
         return lower_ + rng->drand()*range_;
       }
 
+    void raw_values(const Position<2> *, size_t n, librandom::RngPtr& rng, double_t *vals) const
+      { raw_values_(n,rng,vals); }
+    void raw_values(const Position<3> *, size_t n, librandom::RngPtr& rng, double_t *vals) const
+      { raw_values_(n,rng,vals); }
+
+    double_t raw_max_value(double_t, double_t) const
+      { return lower_ + range_; }
+
     Parameter * clone() const
       { return new UniformParameter(*this); }
 
   private:
+    void raw_values_(size_t n, librandom::RngPtr& rng, double_t *vals) const
+      {
+        for (size_t i=0; i<n; ++i)
+          vals[i] = lower_ + rng->drand()*range_;
+      }
+
     double_t lower_, range_;
   };
 
@@ -472,10 +654,29 @@ namespace nest
         return raw_value(rng);
       }
 
+    void raw_values(const Position<2> *, size_t n, librandom::RngPtr& rng, double_t *vals) const
+      { raw_values_(n,rng,vals); }
+    void raw_values(const Position<3> *, size_t n, librandom::RngPtr& rng, double_t *vals) const
+      { raw_values_(n,rng,vals); }
+
     Parameter * clone() const
       { return new NormalParameter(*this); }
 
   private:
+    /**
+     * Draw all values at once, values outside [min,max) are redrawn
+     * individually.
+     */
+    void raw_values_(size_t n, librandom::RngPtr& rng, double_t *vals) const
+      {
+        rdev.fill(rng,vals,n);
+        for (size_t i=0; i<n; ++i) {
+          vals[i] = mean_ + vals[i]*sigma_;
+          if ((vals[i]<min_) or (vals[i]>=max_))
+            vals[i] = raw_value(rng);
+        }
+      }
+
     double_t mean_, sigma_, min_, max_;
     librandom::NormalRandomDev rdev;
   };
@@ -570,6 +771,17 @@ namespace nest
         return p_->raw_value(p-anchor_, rng);
       }
 
+    void raw_values(const Position<D xor 1> *, size_t, librandom::RngPtr&, double_t *) const
+      { throw BadProperty("Incorrect dimension."); }
+
+    void raw_values(const Position<D> *pos, size_t n, librandom::RngPtr& rng, double_t *vals) const
+      {
+        std::vector<Position<D> > shifted(pos,pos+n);
+        for (size_t i=0; i<n; ++i)
+          shifted[i] -= anchor_;
+        p_->raw_values(&shifted[0],n,rng,vals);
+      }
+
     Parameter * clone() const
       { return new AnchoredParameter(*this); }
 
@@ -612,10 +824,25 @@ namespace nest
     double_t raw_value(const Position<3> &p, librandom::RngPtr& rng) const
       { return parameter1_->value(p,rng) * parameter2_->value(p,rng); }
 
+    void raw_values(const Position<2> *pos, size_t n, librandom::RngPtr& rng, double_t *vals) const
+      { raw_values_(pos,n,rng,vals); }
+    void raw_values(const Position<3> *pos, size_t n, librandom::RngPtr& rng, double_t *vals) const
+      { raw_values_(pos,n,rng,vals); }
+
     Parameter * clone() const
       { return new ProductParameter(*this); }
 
   protected:
+    template<int D>
+    void raw_values_(const Position<D> *pos, size_t n, librandom::RngPtr& rng, double_t *vals) const
+      {
+        std::vector<double_t> vals2(n);
+        parameter1_->values(pos,n,rng,vals);
+        parameter2_->values(pos,n,rng,&vals2[0]);
+        for (size_t i=0; i<n; ++i)
+          vals[i] *= vals2[i];
+      }
+
     Parameter *parameter1_, *parameter2_;
   };
 
@@ -653,10 +880,25 @@ namespace nest
     double_t raw_value(const Position<3> &p, librandom::RngPtr& rng) const
       { return parameter1_->value(p,rng) / parameter2_->value(p,rng); }
 
+    void raw_values(const Position<2> *pos, size_t n, librandom::RngPtr& rng, double_t *vals) const
+      { raw_values_(pos,n,rng,vals); }
+    void raw_values(const Position<3> *pos, size_t n, librandom::RngPtr& rng, double_t *vals) const
+      { raw_values_(pos,n,rng,vals); }
+
     Parameter * clone() const
       { return new QuotientParameter(*this); }
 
   protected:
+    template<int D>
+    void raw_values_(const Position<D> *pos, size_t n, librandom::RngPtr& rng, double_t *vals) const
+      {
+        std::vector<double_t> vals2(n);
+        parameter1_->values(pos,n,rng,vals);
+        parameter2_->values(pos,n,rng,&vals2[0]);
+        for (size_t i=0; i<n; ++i)
+          vals[i] /= vals2[i];
+      }
+
     Parameter *parameter1_, *parameter2_;
   };
 
@@ -694,10 +936,28 @@ namespace nest
     double_t raw_value(const Position<3> &p, librandom::RngPtr& rng) const
       { return parameter1_->value(p,rng) + parameter2_->value(p,rng); }
 
+    void raw_values(const Position<2> *pos, size_t n, librandom::RngPtr& rng, double_t *vals) const
+      { raw_values_(pos,n,rng,vals); }
+    void raw_values(const Position<3> *pos, size_t n, librandom::RngPtr& rng, double_t *vals) const
+      { raw_values_(pos,n,rng,vals); }
+
+    double_t raw_max_value(double_t r_min, double_t r_max) const
+      { return parameter1_->max_value(r_min,r_max) + parameter2_->max_value(r_min,r_max); }
+
     Parameter * clone() const
       { return new SumParameter(*this); }
 
   protected:
+    template<int D>
+    void raw_values_(const Position<D> *pos, size_t n, librandom::RngPtr& rng, double_t *vals) const
+      {
+        std::vector<double_t> vals2(n);
+        parameter1_->values(pos,n,rng,vals);
+        parameter2_->values(pos,n,rng,&vals2[0]);
+        for (size_t i=0; i<n; ++i)
+          vals[i] += vals2[i];
+      }
+
     Parameter *parameter1_, *parameter2_;
   };
 
@@ -735,10 +995,25 @@ namespace nest
     double_t raw_value(const Position<3> &p, librandom::RngPtr& rng) const
       { return parameter1_->value(p,rng) - parameter2_->value(p,rng); }
 
+    void raw_values(const Position<2> *pos, size_t n, librandom::RngPtr& rng, double_t *vals) const
+      { raw_values_(pos,n,rng,vals); }
+    void raw_values(const Position<3> *pos, size_t n, librandom::RngPtr& rng, double_t *vals) const
+      { raw_values_(pos,n,rng,vals); }
+
     Parameter * clone() const
       { return new DifferenceParameter(*this); }
 
   protected:
+    template<int D>
+    void raw_values_(const Position<D> *pos, size_t n, librandom::RngPtr& rng, double_t *vals) const
+      {
+        std::vector<double_t> vals2(n);
+        parameter1_->values(pos,n,rng,vals);
+        parameter2_->values(pos,n,rng,&vals2[0]);
+        for (size_t i=0; i<n; ++i)
+          vals[i] -= vals2[i];
+      }
+
     Parameter *parameter1_, *parameter2_;
   };
 
@@ -775,10 +1050,27 @@ namespace nest
     double_t raw_value(const Position<3> &p, librandom::RngPtr& rng) const
       { return p_->raw_value(-p,rng); }
 
+    void raw_values(const Position<2> *pos, size_t n, librandom::RngPtr& rng, double_t *vals) const
+      { raw_values_(pos,n,rng,vals); }
+    void raw_values(const Position<3> *pos, size_t n, librandom::RngPtr& rng, double_t *vals) const
+      { raw_values_(pos,n,rng,vals); }
+
+    double_t raw_max_value(double_t r_min, double_t r_max) const
+      { return p_->raw_max_value(r_min,r_max); }
+
     Parameter * clone() const
       { return new ConverseParameter(*this); }
 
   protected:
+    template<int D>
+    void raw_values_(const Position<D> *pos, size_t n, librandom::RngPtr& rng, double_t *vals) const
+      {
+        std::vector<Position<D> > reversed(n);
+        for (size_t i=0; i<n; ++i)
+          reversed[i] = -pos[i];
+        p_->raw_values(&reversed[0],n,rng,vals);
+      }
+
     Parameter *p_;
   };
 